@@ -49,10 +49,64 @@ This library implements the following features:
   29. Get BSY status
   30. Get Aging Register value
   31. Set Aging Register value
+  32. Read all registers in a single transaction as a snapshot
+  33. Control / Status Register shadow copy for single write bit updates and cached getters
+  34. Non-blocking temperature conversion with poll cadence, timeout and callback
+  35. Read / Set Date and Time as Unix epoch seconds (32 and 64 bit)
+  36. Millisecond software clock extrapolated with millis() and periodic resync (Himadri_DS3231_Clock)
+  37. Select 1Hz / 1.024kHz / 4.096kHz / 8.192kHz square wave and count its ticks in an interrupt (Himadri_DS3231_SQW)
+  38. Microsecond timestamps from the 1Hz square wave edge without I2C traffic per event
+  39. Software alarm scheduler multiplexing many jobs onto Alarm1 (Himadri_DS3231_Scheduler)
+  40. Register level transport interface so the driver runs over TwoWire, other buses or the simulator (Himadri_DS3231_Transport)
+  41. Linux i2c-dev transport with the register address write and burst read in one I2C_RDWR repeated START transaction (Himadri_DS3231_LinuxTransport)
+  42. Optional bus counters and per API latency histograms, compiled out unless HIMADRI_DS3231_STATS is defined (Himadri_DS3231_Stats)
+  43. Host benchmark of bus transactions, bytes and ns/op per API with a baseline that fails the run on regressions (extras/benchmark)
+  44. Integer temperature in 0.25 degree steps or hundredths of Celsius / Fahrenheit / Kelvin without floating point
+  45. BCD registers decoded in one pass with a 256 byte flash table and encoded without a division, HIMADRI_DS3231_BCD_ARITHMETIC selects the arithmetic conversion
+  46. Alarm register values computed at compile time from constexpr specifications and written in one transaction (Himadri_DS3231_AlarmSpec)
+  47. Set Date and Time in one transaction after validating every field, leaving the clock and the structure untouched on error
+  48. Set Date and Time on the second boundary of a reference time with a sub-second phase, reporting the write latency
+  49. Alarm interrupt dispatcher with a lock-free ring filled by the interrupt handler and a loop() pump reading and clearing A1F / A2F in one write (Himadri_DS3231_Events)
+  50. Deep-sleep wake planner programming the next wake into Alarm1 with one burst write and moving the software clock to the wake edge after one read (Himadri_DS3231_Sleep)
+  51. Boot configuration probing the chip and writing Control and Status Register in one transaction, returning a status code without Serial output
+  52. Instances on any TwoWire bus and address, so chips on separate I2C controllers are driven independently
+  53. TCA9548A multiplexer device handles skipping redundant channel selects and a poll reading N chips with one select per channel (Himadri_DS3231_Mux)
+  54. Fluent setter transaction validating the changed fields together and writing each run of consecutive registers in one burst (Himadri_DS3231_Transaction)
 
 ******************************/
 
 #include "Himadri_DS3231.h"
+#include "Himadri_DS3231_AlarmSpec.h"
+#include "Himadri_DS3231_Transaction.h"
+
+/*-------------------------------
+      BCD To Decimal Table
+      Storing It In Flash
+-------------------------------*/
+#if !defined(HIMADRI_DS3231_BCD_ARITHMETIC)
+static const uint8_t bcdToDec[256] PROGMEM = {
+    0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
+   10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+   20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+   30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45,
+   40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+   50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65,
+   60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75,
+   70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+   80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+   90, 91, 92, 93, 94, 95, 96, 97, 98, 99,100,101,102,103,104,105,
+  100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,
+  110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,
+  120,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,
+  130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,
+  140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,
+  150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165
+};
+#endif
+/*-------------------------------
+      BCD To Decimal Table
+      Storing It In Flash
+-------------------------------*/
 
 /*-------------------------------
   Private Function Definition
@@ -61,27 +115,47 @@ This library implements the following features:
 /**
   Returns Decimal to BCD.
 **/
-static uint8_t Himadri_DS3231::dec2bcd(uint8_t value) {
-  // Left shifting the first number by 4 bits and adding the second number we get the BCD number
-  uint8_t convertedVal = (value / 10 * 16) + (value % 10);
+uint8_t Himadri_DS3231::dec2bcd(uint8_t value) {
+  #if defined(HIMADRI_DS3231_BCD_ARITHMETIC)
+    // Left shifting the first number by 4 bits and adding the second number we get the BCD number
+    uint8_t convertedVal = (value / 10 * 16) + (value % 10);
+  #else
+    // value * 205 >> 11 is value / 10 for 0 - 255 without a division,
+    // 16 * tens + ones is value + 6 * tens
+    uint8_t tens = ((uint16_t)value * 205) >> 11;
+    uint8_t convertedVal = value + tens * 6;
+  #endif
   return convertedVal;
 };
 
 /**
   Returns BCD to Decimal.
 **/
-static uint8_t Himadri_DS3231::bcd2dec(uint8_t value) {
-  // Right shifting the first number and mulitplying by 10 and then extracting the lastnumber using mod
-  // after that adding it to the first number
-  // modul or % in binary is n % 2^i = n & (2^i - 1)
-  uint8_t convertedVal = (value / 16 * 10) + (value % 16);
+uint8_t Himadri_DS3231::bcd2dec(uint8_t value) {
+  #if defined(HIMADRI_DS3231_BCD_ARITHMETIC)
+    // Right shifting the first number and mulitplying by 10 and then extracting the lastnumber using mod
+    // after that adding it to the first number
+    // modul or % in binary is n % 2^i = n & (2^i - 1)
+    uint8_t convertedVal = (value / 16 * 10) + (value % 16);
+  #else
+    uint8_t convertedVal = pgm_read_byte(bcdToDec + value);
+  #endif
   return convertedVal;
 };
 
+/**
+  Returns BCD to Decimal of consecutive registers.
+**/
+void Himadri_DS3231::bcd2decBlock(const uint8_t* buf, const uint8_t* masks, uint8_t* values, uint8_t len) {
+  for(uint8_t i = 0; i < len; i++) {
+    values[i] = bcd2dec(buf[i] & masks[i]);
+  }
+};
+
 /**
   Returns 2 digit decimal from String.
 **/
-static uint8_t Himadri_DS3231::conv2d2(const char* p) {
+uint8_t Himadri_DS3231::conv2d2(const char* p) {
     uint8_t v = 0;
     if ('0' <= *p && *p <= '9')
         v = *p - '0';
@@ -91,7 +165,7 @@ static uint8_t Himadri_DS3231::conv2d2(const char* p) {
 /**
   Returns 4 digit decimal from String.
 **/
-static uint16_t Himadri_DS3231::conv2d4(const char* p) {
+uint16_t Himadri_DS3231::conv2d4(const char* p) {
     uint16_t v = 0;
     if ('0' <= *p && *p <= '9')
         v = *p - '0';
@@ -133,36 +207,375 @@ boolean Himadri_DS3231::monthDateYearValidation(uint8_t date, uint8_t month, uin
   Reads 8 bit register value from the address specified.
 **/
 uint8_t Himadri_DS3231::readRegister(uint8_t regaddress) {
-    Wire.beginTransmission(DS3231_ADDRESS);
-    #if (ARDUINO >= 100)
-      Wire.write((byte)regaddress);
-    #else
-      Wire.send((byte)regaddress);
-    #endif
-    Wire.endTransmission();
-
-    Wire.requestFrom(DS3231_ADDRESS, 1, true);
-    #if (ARDUINO >= 100)
-      return Wire.read();      // receive DATA
-    #else
-      return Wire.receive();   // receive DATA
-    #endif
+  uint8_t value = 0xFF;
+  readRegisters(regaddress, &value, 1);
+  return value;
 };
 
 /**
   Writes 8 bit value to the register address specified.
 **/
-void Himadri_DS3231::writeRegister(uint8_t regaddress, uint8_t value) {
-    Wire.beginTransmission(DS3231_ADDRESS);
+boolean Himadri_DS3231::writeRegister(uint8_t regaddress, uint8_t value) {
+  return writeRegisters(regaddress, &value, 1);
+};
+
+/**
+  Reads consecutive registers in a single transaction.
+**/
+boolean Himadri_DS3231::readRegisters(uint8_t regaddress, uint8_t* buf, uint8_t len) {
+  uint8_t status = bus != NULL ? bus->readRegisters(regaddress, buf, len) :
+    Himadri_DS3231_WireTransport::readRegisters(*wire, deviceAddress, regaddress, buf, len);
+
+  DS3231_STATS_BUS(status, 1, len);
+  if(status != DS3231_BUS_OK) {
+    return false;
+  }
+  return true;
+};
+
+/**
+  Writes consecutive registers in a single transaction.
+**/
+boolean Himadri_DS3231::writeRegisters(uint8_t regaddress, const uint8_t* buf, uint8_t len) {
+  uint8_t status = writeBus(regaddress, buf, len);
+
+  DS3231_STATS_BUS(status, len + 1, 0);
+  if(status != DS3231_BUS_OK) {
+    return false;
+  }
+  return true;
+};
+
+/**
+  Initialize the bus and address the device without data.
+**/
+uint8_t Himadri_DS3231::probeBus() {
+  if(bus != NULL) {
+    bus->begin();
+    return bus->probe();
+  }
+  wire->begin();
+  return Himadri_DS3231_WireTransport::probe(*wire, deviceAddress);
+};
+
+/**
+  Writes consecutive registers through the transport or the TwoWire bus.
+**/
+uint8_t Himadri_DS3231::writeBus(uint8_t regaddress, const uint8_t* buf, uint8_t len) {
+  if(bus != NULL) {
+    return bus->writeRegisters(regaddress, buf, len);
+  }
+  return Himadri_DS3231_WireTransport::writeRegisters(*wire, deviceAddress, regaddress, buf, len);
+};
+
+/**
+  Validate and encode Date and Time into the 7 timekeeping registers.
+**/
+boolean Himadri_DS3231::encodeDateTime(const struct timeParameters* timeVals, uint8_t* buf) {
+  if(timeVals->ss > 59 || timeVals->mm > 59 || timeVals->day < 1 || timeVals->day > 7 ||
+    timeVals->d < 1 || timeVals->m < 1 || timeVals->m > 12 ||
+    monthDateYearValidation(timeVals->d, timeVals->m, timeVals->y) == false) {
+    return false;
+  }
+
+  buf[0] = dec2bcd(timeVals->ss);                   // seconds
+  buf[1] = dec2bcd(timeVals->mm);                   // minutes
+  if(timeVals->tf == 1) {
+    if(timeVals->hh < 1 || timeVals->hh > 12) {
+      return false;
+    }
+    if(timeVals->md == 0) {
+      buf[2] = dec2bcd(timeVals->hh) | 0x40;        // 01000000
+    } else if(timeVals->md == 1) {
+      buf[2] = dec2bcd(timeVals->hh) | 0x60;        // 01100000
+    } else {
+      return false;
+    }
+  } else {
+    if(timeVals->hh > 23) {
+      return false;
+    }
+    buf[2] = dec2bcd(timeVals->hh);                 // hour
+  }
+  buf[3] = dec2bcd(timeVals->day);                  // day
+  buf[4] = dec2bcd(timeVals->d);                    // date
+  if(timeVals->y >= 2000) {
+    buf[5] = dec2bcd(timeVals->m) | 0x80;           // 10000000
+    buf[6] = dec2bcd(timeVals->y - 2000);
+  } else {
+    buf[5] = dec2bcd(timeVals->m);
+    buf[6] = dec2bcd(timeVals->y - 1900);
+  }
+
+  return true;
+};
+
+/**
+  Decode the 7 timekeeping registers.
+**/
+void Himadri_DS3231::decodeDateTime(const uint8_t* buf, struct timeParameters* timeVals) {
+  uint8_t masks[7] = {0x7F, 0x7F, 0x3F, 0x07, 0x3F, 0x1F, 0xFF};   // BCD bits of every register
+  uint8_t values[7];
+
+  if((buf[2] & 0x40) >> 6 == 1) {                   // 01000000
+    masks[2] = 0x1F;                                // 00011111
+  }
+  bcd2decBlock(buf, masks, values, 7);
+
+  timeVals->ss = values[0];
+  timeVals->mm = values[1];
+  if((buf[2] & 0x40) >> 6 == 1) {                   // 01000000
+    timeVals->tf = 1;
+    if((buf[2] & 0x20) >> 5 == 1) {                 // 00100000
+      timeVals->md = 1;
+    } else {
+      timeVals->md = 0;
+    }
+  } else {
+    timeVals->tf = 0;
+    timeVals->md = 3;
+  }
+  timeVals->hh = values[2];
+  timeVals->day = values[3];
+  timeVals->d = values[4];
+  timeVals->m = values[5];
+  if((buf[5] & 0x80) >> 7 == 1) {                   // 10000000
+    timeVals->y = 2000 + values[6];
+  } else {
+    timeVals->y = 1900 + values[6];
+  }
+};
+
+/**
+  Returns the number of days since 1970/01/01 of a civil date.
+**/
+int32_t Himadri_DS3231::daysFromCivil(uint16_t year, uint8_t month, uint8_t date) {
+  // Shift the year to start on 1st March so the leap day is the last day of the year
+  if(month <= 2) {
+    year = year - 1;
+  }
+  uint16_t era = year / 400;
+  uint16_t yoe = year - era * 400;                                        // [0, 399]
+  uint16_t doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + date - 1;  // [0, 365]
+  uint32_t doe = (uint32_t)yoe * 365 + yoe / 4 - yoe / 100 + doy;         // [0, 146096]
+  return (int32_t)era * 146097 + (int32_t)doe - 719468;
+};
+
+/**
+  Decode the 7 timekeeping registers to days since 1970/01/01 and seconds of the day.
+**/
+void Himadri_DS3231::decodeEpoch(const uint8_t* buf, int32_t* days, uint32_t* secs) {
+  uint8_t masks[7] = {0x7F, 0x7F, 0x3F, 0x07, 0x3F, 0x1F, 0xFF};   // BCD bits of every register
+  uint8_t values[7];
+  uint8_t hh;
+
+  if((buf[2] & 0x40) >> 6 == 1) {                   // 01000000
+    masks[2] = 0x1F;                                // 00011111
+  }
+  bcd2decBlock(buf, masks, values, 7);
+
+  if((buf[2] & 0x40) >> 6 == 1) {                   // 01000000
+    hh = values[2] % 12;
+    if((buf[2] & 0x20) >> 5 == 1) {                 // 00100000
+      hh = hh + 12;
+    }
+  } else {
+    hh = values[2];
+  }
+
+  uint16_t year = values[6];
+  if((buf[5] & 0x80) >> 7 == 1) {                   // 10000000
+    year = year + 2000;
+  } else {
+    year = year + 1900;
+  }
+
+  *days = daysFromCivil(year, values[5], values[4]);
+  *secs = (uint32_t)hh * 3600 + (uint16_t)values[1] * 60 + values[0];
+};
+
+/**
+  Encode days since 1970/01/01 and seconds of the day into the 7 timekeeping registers.
+**/
+void Himadri_DS3231::encodeEpoch(int32_t days, uint32_t secs, uint8_t timeFormat, uint8_t* buf) {
+  uint8_t hh = secs / 3600;
+  uint16_t rem = secs % 3600;
+
+  buf[0] = dec2bcd(rem % 60);                       // seconds
+  buf[1] = dec2bcd(rem / 60);                       // minutes
+  if(timeFormat == TwelveHrFormat) {
+    if(hh >= 12) {
+      buf[2] = dec2bcd(hh == 12 ? 12 : hh - 12) | 0x60;   // 01100000
+    } else {
+      buf[2] = dec2bcd(hh == 0 ? 12 : hh) | 0x40;         // 01000000
+    }
+  } else {
+    buf[2] = dec2bcd(hh);                           // hour
+  }
+
+  // 1970/01/01 was a Thursday, Sunday is 1
+  buf[3] = (uint8_t)(((days % 7) + 11) % 7) + 1;   // day
+
+  // Civil date from days, the year starts on 1st March
+  uint32_t z = (uint32_t)(days + 719468);
+  uint16_t era = z / 146097;
+  uint32_t doe = z - (uint32_t)era * 146097;                                      // [0, 146096]
+  uint16_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;           // [0, 399]
+  uint16_t doy = doe - ((uint32_t)yoe * 365 + yoe / 4 - yoe / 100);               // [0, 365]
+  uint8_t mp = (5 * doy + 2) / 153;                                               // [0, 11]
+  uint8_t date = doy - (153 * mp + 2) / 5 + 1;
+  uint8_t month = mp < 10 ? mp + 3 : mp - 9;
+  uint16_t year = yoe + era * 400 + (month <= 2 ? 1 : 0);
+
+  buf[4] = dec2bcd(date);                           // date
+  if(year >= 2000) {
+    buf[5] = dec2bcd(month) | 0x80;                 // 10000000
+    buf[6] = dec2bcd(year - 2000);
+  } else {
+    buf[5] = dec2bcd(month);
+    buf[6] = dec2bcd(year - 1900);
+  }
+};
+
+/**
+  Decode the minutes, hour and day / date alarm registers.
+**/
+void Himadri_DS3231::decodeAlarm(const uint8_t* buf, struct alarmParameters* alarmVals) {
+  uint8_t masks[3] = {0x7F, 0x3F, 0x3F};                      // BCD bits of every register
+  uint8_t values[3];
+
+  if((buf[1] & 0x40) >> 6 == 1) {                             // 01000000
+    masks[1] = 0x1F;                                          // 00011111
+  }
+  bcd2decBlock(buf, masks, values, 3);
+
+  alarmVals->mm = values[0];
+  if((buf[1] & 0x40) >> 6 == 1) {                             // 01000000
+    alarmVals->tf = 1;
+    if((buf[1] & 0x20) >> 5 == 1) {
+      alarmVals->md = 1;
+    } else {
+      alarmVals->md = 0;
+    }
+  } else {
+    alarmVals->tf = 0;
+    alarmVals->md = 3;
+  }
+  alarmVals->hh = values[1];
+
+  if((buf[2] & 0x40) >> 6 == 1) {                             // 01000000
+    alarmVals->dyDt = 1;
+  } else {
+    alarmVals->dyDt = 0;
+  }
+  alarmVals->dayDate = values[2];
+};
+
+/**
+  Decode the temperature registers.
+**/
+float Himadri_DS3231::decodeTemp(uint8_t msb, uint8_t lsb) {
+  return decodeTempRaw(msb, lsb) * 0.25;
+};
+
+/**
+  Decode the temperature registers to 0.25 degree steps.
+**/
+int16_t Himadri_DS3231::decodeTempRaw(uint8_t msb, uint8_t lsb) {
+  // MSB is the two's complement integer part, the upper 2 bits of LSB are the quarter degrees
+  return (int16_t)(int8_t)msb * 4 + (lsb >> 6);
+};
+
+/**
+  Returns the Control Register value from the shadow copy.
+**/
+uint8_t Himadri_DS3231::controlShadow() {
+  if(shadowValid == false) {
+    refreshShadow();
+  }
+  // CONV is owned by the chip, it must not be written back as 1
+  return ctRegShadow & 0xDF;                    // 11011111
+};
+
+/**
+  Returns the Status Register value from the shadow copy.
+**/
+uint8_t Himadri_DS3231::statusShadow() {
+  if(shadowValid == false) {
+    refreshShadow();
+  }
+  return statusRegShadow;
+};
+
+/**
+  Write the Control Register and update the shadow copy.
+**/
+boolean Himadri_DS3231::writeControl(uint8_t value) {
+  if(writeRegister(DS3231_CONTROL_REG, value) == false) {
+    // The chip may or may not have taken the value
+    shadowValid = false;
+    return false;
+  }
+  // CONV is cleared by the chip when the conversion is done
+  ctRegShadow = value & 0xDF;                   // 11011111
+  return true;
+};
+
+/**
+  Write the Status Register and update the shadow copy.
+**/
+boolean Himadri_DS3231::writeStatus(uint8_t value, uint8_t clearMask) {
+  // Writing 1 to OSF / A2F / A1F leaves them unchanged, only the requested flags are cleared
+  value = (value | 0x83) & ~(clearMask & 0x83);   // 10000011
+  if(writeRegister(DS3231_STATUS_REG, value) == false) {
+    // The chip may or may not have taken the value
+    shadowValid = false;
+    return false;
+  }
+  statusRegShadow = (statusRegShadow & 0x87) & ~(clearMask & 0x83);    // 10000111
+  statusRegShadow |= value & 0x08;              // 00001000
+  return true;
+};
+
+/**
+  Reset the shadow copy and the temperature conversion state.
+**/
+void Himadri_DS3231::initState() {
+  ctRegShadow = 0;
+  statusRegShadow = 0;
+  shadowValid = false;
+  convState = ConvIdle;
+  convStartMs = 0;
+  convPollMs = 0;
+  convInterval = DS3231_CONV_POLL_MS;
+  convTimeout = DS3231_CONV_TIMEOUT_MS;
+  convCallback = NULL;
+};
 
-    #if (ARDUINO >= 100)
-      Wire.write((byte)regaddress);
-      Wire.write((byte)value);
-    #else
-      Wire.send((byte)regaddress);
-      Wire.send((byte)value);
-    #endif
-    Wire.endTransmission();
+/**
+  Encode the hour of an alarm register with time format and meridian.
+**/
+boolean Himadri_DS3231::encodeAlarmHour(uint8_t hh, boolean tf, boolean md, uint8_t* reg) {
+  if(tf == true && md == true) {
+    if(hh <= 12 && hh >=1) {
+      *reg = dec2bcd(hh) & 0x7F | 0x60;     // 01111111 | 01100000
+    } else {
+      return false;
+    }
+  } else if(tf == true && md == false) {
+    if(hh <= 12 && hh >=1) {
+      *reg = dec2bcd(hh) & 0x5F | 0x40;     // 01011111 | 01000000
+    } else {
+      return false;
+    }
+  } else {
+    if(hh <= 23 && hh >=0) {
+      *reg = dec2bcd(hh) & 0x3F;            // 00111111
+    } else {
+      return false;
+    }
+  }
+  return true;
 };
 
 /*-------------------------------
@@ -172,56 +585,115 @@ void Himadri_DS3231::writeRegister(uint8_t regaddress, uint8_t value) {
 /**
   Clear Alarm Flag in Status Register.
 **/
-void Himadri_DS3231::clearINTStatus(uint8_t alarm)
+boolean Himadri_DS3231::clearINTStatus(uint8_t alarm)
 {
+  DS3231_STATS_API(DS3231_API_CLEAR_INT_STATUS);
     // Clear interrupt flag
-    uint8_t statusReg = readRegister(DS3231_STATUS_REG);
+    uint8_t statusReg = statusShadow();
     if(alarm == 1) {
-      statusReg &= 0xFE;        // 11111110
-      writeRegister(DS3231_STATUS_REG, statusReg);
+      return writeStatus(statusReg, 0x01);        // 00000001
     } else if(alarm == 2) {
-      statusReg &= 0xFD;        // 11111101
-      writeRegister(DS3231_STATUS_REG, statusReg);
+      return writeStatus(statusReg, 0x02);        // 00000010
     } else if(alarm == 3) {
-      statusReg &= 0xFC;        // 11111100
-      writeRegister(DS3231_STATUS_REG, statusReg);
+      return writeStatus(statusReg, 0x03);        // 00000011
     }
+    return false;
+};
+
+/**
+  Read the alarm flags and clear the ones found set in a single write.
+**/
+boolean Himadri_DS3231::readClearAlarmStatus(uint8_t* alarms) {
+  DS3231_STATS_API(DS3231_API_READ_CLEAR_ALARMS);
+  uint8_t statusReg;
+
+  if(readRegisters(DS3231_STATUS_REG, &statusReg, 1) == false) {
+    return false;
+  }
+  statusRegShadow = statusReg;
+  // A1F and A2F are bit 0 and 1, the same values as Alarm1 / Alarm2 / BothAlarm
+  *alarms = statusReg & 0x03;                 // 00000011
+
+  if(*alarms != 0) {
+    return writeStatus(statusReg, *alarms);
+  }
+
+  return true;
+};
+
+/**
+  Create the driver on the Wire bus with an invalid Control / Status shadow copy.
+**/
+Himadri_DS3231::Himadri_DS3231() {
+  bus = NULL;
+  wire = &Wire;
+  deviceAddress = DS3231_ADDRESS;
+  initState();
+};
+
+/**
+  Create the driver on a TwoWire bus and address with an invalid Control / Status shadow copy.
+**/
+Himadri_DS3231::Himadri_DS3231(TwoWire& wire, uint8_t address) {
+  bus = NULL;
+  this->wire = &wire;
+  deviceAddress = address;
+  initState();
+};
+
+/**
+  Create the driver on a transport with an invalid Control / Status shadow copy.
+**/
+Himadri_DS3231::Himadri_DS3231(Himadri_DS3231_Transport& transport) {
+  bus = &transport;
+  wire = NULL;
+  deviceAddress = DS3231_ADDRESS;
+  initState();
+};
+
+/**
+  Read Control and Status Register in a single transaction into the shadow copy.
+**/
+boolean Himadri_DS3231::refreshShadow() {
+  DS3231_STATS_API(DS3231_API_REFRESH_SHADOW);
+  uint8_t buf[2];
+
+  if(readRegisters(DS3231_CONTROL_REG, buf, 2) == false) {
+    shadowValid = false;
+    return false;
+  }
+  ctRegShadow = buf[0];
+  statusRegShadow = buf[1];
+  shadowValid = true;
+  return true;
+};
+
+/**
+  Mark the Control / Status shadow copy invalid.
+**/
+void Himadri_DS3231::invalidateShadow() {
+  shadowValid = false;
 };
 
 /**
   Initialize the Timekeeping Register value with initial Date and Time of 1900/01/01 WED 00:00:00AM or 00:00:00.
 **/
 void Himadri_DS3231::clearTimeRegister(uint8_t timeFormat) {
-  Wire.beginTransmission(DS3231_ADDRESS);
-
-  #if (ARDUINO >= 100)
-    Wire.write(DS3231_SECONDS_REG);
-    Wire.write(dec2bcd(0));             // seconds
-    Wire.write(dec2bcd(0));             // minutes
-    if(timeFormat == 0x01) {            // 00000001
-      Wire.write(dec2bcd(0) | 0x40);    // 01000000
-    } else {
-      Wire.write(dec2bcd(0));           // hour
-    }
-    Wire.write(dec2bcd(4));             // day
-    Wire.write(dec2bcd(1));             // date
-    Wire.write(dec2bcd(1));             // month
-    Wire.write(dec2bcd(0));             // year
-  #else
-    Wire.send(DS3231_SECONDS_REG);
-    Wire.send(dec2bcd(0));              // seconds
-    Wire.send(dec2bcd(0));              // minutes
-    if(timeFormat == 0x01) {
-      Wire.send(dec2bcd(0) | 0x40);     // 01000000
-    } else {
-      Wire.send(dec2bcd(0));            // hour
-    }
-    Wire.send(dec2bcd(2));              // day
-    Wire.send(dec2bcd(1));              // date
-    Wire.send(dec2bcd(1));              // month
-    Wire.send(dec2bcd(0));              // year
-  #endif
-  Wire.endTransmission();
+  DS3231_STATS_API(DS3231_API_CLEAR_TIME_REGISTER);
+  uint8_t buf[7];
+
+  buf[0] = dec2bcd(0);                // seconds
+  buf[1] = dec2bcd(0);                // minutes
+  if(timeFormat == 0x01) {            // 00000001
+    buf[2] = dec2bcd(0) | 0x40;       // 01000000
+  } else {
+    buf[2] = dec2bcd(0);              // hour
+  }
+  buf[3] = dec2bcd(4);                // day
+  buf[4] = dec2bcd(1);                // date
+  buf[5] = dec2bcd(1);                // month
+  buf[6] = dec2bcd(0);                // year
+  writeRegisters(DS3231_SECONDS_REG, buf, 7);
 };
 
 /**
@@ -229,20 +701,53 @@ void Himadri_DS3231::clearTimeRegister(uint8_t timeFormat) {
   Also clear the both Alarm Flag from Status Register.
 **/
 boolean Himadri_DS3231::begin() {
-  Wire.begin();
-  Wire.beginTransmission(DS3231_ADDRESS);
-  if(Wire.endTransmission() != 0) {
-    Serial.println("Cannot communicate with device.");
+  DS3231_STATS_API(DS3231_API_BEGIN);
+  uint8_t status = probeBus();
+  DS3231_STATS_BUS(status, 0, 0);
+  if(status != DS3231_BUS_OK) {
     return false;
-  } else {
-    Serial.println("Can communicate with device.");
   }
   // Initialize the Control Register
-  uint8_t ctReg = readRegister(DS3231_CONTROL_REG);
+  refreshShadow();
+  uint8_t ctReg = controlShadow();
   ctReg &= 0xFC;                                // 11111100
-  writeRegister(DS3231_CONTROL_REG, ctReg);     //CONTROL Register Address
-  clearINTStatus(BothAlarm);
-  return true;
+  if(writeControl(ctReg) == false) {            //CONTROL Register Address
+    return false;
+  }
+  return clearINTStatus(BothAlarm);
+};
+
+/**
+  Probe the chip and write Control and Status Register in one transaction.
+**/
+uint8_t Himadri_DS3231::beginConfig(const struct configParameters* config) {
+  DS3231_STATS_API(DS3231_API_BEGIN_CONFIG);
+  uint8_t buf[2];
+
+  uint8_t status = probeBus();
+  DS3231_STATS_BUS(status, 0, 0);
+  if(status != DS3231_BUS_OK) {
+    return DS3231_BEGIN_PROBE | (status & 0x0F);
+  }
+
+  buf[0] = (config == NULL ? DS3231_CONFIG_CONTROL : config->control) & 0xDF;   // 11011111
+  // OSF written as 1 is unchanged, A1F and A2F written as 0 are cleared
+  buf[1] = 0x80;                                                            // 10000000
+  if(config == NULL ? DS3231_CONFIG_EN32KHZ : config->en32kHz) {
+    buf[1] |= 0x08;                                                         // 00001000
+  }
+
+  status = writeBus(DS3231_CONTROL_REG, buf, 2);
+  DS3231_STATS_BUS(status, 3, 0);
+  if(status != DS3231_BUS_OK) {
+    shadowValid = false;
+    return DS3231_BEGIN_CONFIG | (status & 0x0F);
+  }
+  // A1F, A2F and BSY read as 0 after the write, OSF stays set until it is read
+  ctRegShadow = buf[0];
+  statusRegShadow = buf[1];
+  shadowValid = true;
+  return DS3231_BEGIN_OK;
 };
 
 /**
@@ -306,6 +811,7 @@ boolean Himadri_DS3231::initializeDateTime(const char* date, const char* time, s
   Set Date and Time in 12 / 24 Hr format by passing the timeParameters structure variable
 **/
 boolean Himadri_DS3231::setDateTime(struct timeParameters* timeVals) {
+  DS3231_STATS_API(DS3231_API_SET_DATE_TIME);
   // uint8_t tf;   // time format -> 0 for 24Hr format / 1 for 12Hr format
   // uint8_t ss;   // seconds
   // uint8_t mm;   // minutes
@@ -315,582 +821,527 @@ boolean Himadri_DS3231::setDateTime(struct timeParameters* timeVals) {
   // uint8_t d;    // date of the month
   // uint8_t m;    // month
   // uint16_t y;   // year
+  uint8_t buf[7];
 
   if(monthDateYearValidation(timeVals->d, timeVals->m, timeVals->y) == false) {
     timeVals = {}; // reset
     return false;
   }
 
-  Wire.beginTransmission(DS3231_ADDRESS);
+  // Setting seconds register
+  if(timeVals->ss <= 59 && timeVals->ss >= 0) {
+    buf[0] = dec2bcd(timeVals->ss);
+  } else {
+    if(timeVals->tf == 1) {
+      clearTimeRegister(TwelveHrFormat);
+    } else {
+      clearTimeRegister(TwentyFourHrFormat);
+    }
+    return false;
+  }
 
-  #if (ARDUINO >= 100)
-    Wire.write((byte)DS3231_SECONDS_REG);
+  // Setting minutes register
+  if(timeVals->mm <= 59 && timeVals->mm >= 0) {
+    buf[1] = dec2bcd(timeVals->mm);
+  } else {
+    if(timeVals->tf == 1) {
+      clearTimeRegister(TwelveHrFormat);
+    } else {
+      clearTimeRegister(TwentyFourHrFormat);
+    }
+    return false;
+  }
 
-    // Setting seconds register
-    if(timeVals->ss <= 59 && timeVals->ss >= 0) {
-      Wire.write((byte)dec2bcd(timeVals->ss));
+  // Checking the time format
+  if(timeVals->tf == 1) {
+    if(timeVals->md == 0 && timeVals->hh <= 12 && timeVals->hh >= 1) {
+      // Changed the bit 6 of Hours register to 1 to set 12Hr format and bit 5 of Hours register to 0 to set meridian to AM
+      timeVals->hh = dec2bcd(timeVals->hh) | 0x40;    // 01000000
+      timeVals->hh &= 0xDF;                           // 11011111
+      buf[2] = timeVals->hh;
+    } else if(timeVals->md == 1 && timeVals->hh <= 12 && timeVals->hh >= 1) {
+      // Changed the bit 6 of Hours register to 1 to set 12Hr format and bit 5 of Hours register to 1 to set meridian to PM
+      timeVals->hh = dec2bcd(timeVals->hh) | 0x60;    // 01100000
+      buf[2] = timeVals->hh;
     } else {
-      if(timeVals->tf == 1) {
-        clearTimeRegister(TwelveHrFormat);
-      } else {
-        clearTimeRegister(TwentyFourHrFormat);
-      }
-      Wire.endTransmission();
+      clearTimeRegister(TwelveHrFormat);
       return false;
     }
-
-    // Setting minutes register
-    if(timeVals->mm <= 59 && timeVals->mm >= 0) {
-      Wire.write((byte)dec2bcd(timeVals->mm));
+  } else {
+    if(timeVals->hh <= 23 && timeVals->hh >= 0) {
+      // Changed the bit 6 of Hours register to 0 to set 24Hr format
+      timeVals->hh = dec2bcd(timeVals->hh) & 0xBF;  // 10111111
+      buf[2] = timeVals->hh;
     } else {
-      if(timeVals->tf == 1) {
-        clearTimeRegister(TwelveHrFormat);
-      } else {
-        clearTimeRegister(TwentyFourHrFormat);
-      }
-      Wire.endTransmission();
+      clearTimeRegister(TwentyFourHrFormat);
       return false;
     }
+  }
 
-    // Checking the time format
+  // Setting day register
+  if(timeVals->day >= 1 && timeVals->day <= 7) {
+    buf[3] = dec2bcd(timeVals->day);
+  } else {
     if(timeVals->tf == 1) {
-      if(timeVals->md == 0 && timeVals->hh <= 12 && timeVals->hh >= 1) {
-        // Changed the bit 6 of Hours register to 1 to set 12Hr format and bit 5 of Hours register to 0 to set meridian to AM
-        timeVals->hh = dec2bcd(timeVals->hh) | 0x40;    // 01000000
-        timeVals->hh &= 0xDF;                           // 11011111
-        Wire.write((byte)timeVals->hh);
-      } else if(timeVals->md == 1 && timeVals->hh <= 12 && timeVals->hh >= 1) {
-        // Changed the bit 6 of Hours register to 1 to set 12Hr format and bit 5 of Hours register to 1 to set meridian to PM
-        timeVals->hh = dec2bcd(timeVals->hh) | 0x60;    // 01100000
-        Wire.write((byte)timeVals->hh);
-      } else {
-        if(timeVals->tf == 1) {
-          clearTimeRegister(TwelveHrFormat);
-        } else {
-          clearTimeRegister(TwentyFourHrFormat);
-        }
-        Wire.endTransmission();
-        return false;
-      }
+      clearTimeRegister(TwelveHrFormat);
     } else {
-      if(timeVals->hh <= 23 && timeVals->hh >= 0) {
-        // Changed the bit 6 of Hours register to 0 to set 24Hr format
-        timeVals->hh = dec2bcd(timeVals->hh) & 0xBF;  // 10111111
-        Wire.write((byte)timeVals->hh);
-      } else {
-        if(timeVals->tf == 1) {
-          clearTimeRegister(TwelveHrFormat);
-        } else {
-          clearTimeRegister(TwentyFourHrFormat);
-        }
-        Wire.endTransmission();
-        return false;
-      }
-    }
-
-    // Setting day register
-    if(timeVals->day >= 1 && timeVals->day <= 7) {
-      Wire.write((byte)dec2bcd(timeVals->day));
-    } else {
-      if(timeVals->tf == 1) {
-        clearTimeRegister(TwelveHrFormat);
-      } else {
-        clearTimeRegister(TwentyFourHrFormat);
-      }
-      Wire.endTransmission();
-      return false;
-    }
-
-    // Setting dates register
-    if(timeVals->d > 0 && timeVals->d <= 31) {
-      Wire.write((byte)dec2bcd(timeVals->d));
-    } else {
-      if(timeVals->tf == 1) {
-        clearTimeRegister(TwelveHrFormat);
-      } else {
-        clearTimeRegister(TwentyFourHrFormat);
-      }
-      Wire.endTransmission();
-      return false;
-    }
-
-    // Setting month and year register
-    if(timeVals->y >= 2000 && timeVals->y < 2100) {
-      timeVals->m = dec2bcd(timeVals->m) | 0x80;  // 10000000
-      timeVals->y = timeVals->y - 2000;
-      Wire.write((byte)timeVals->m);
-      Wire.write((byte)dec2bcd(timeVals->y));
-    } else if (timeVals->y >= 1900) {
-      timeVals->m = dec2bcd(timeVals->m) & 0x7F;  // 01111111
-      timeVals->y = timeVals->y - 1900;
-      Wire.write((byte)timeVals->m);
-      Wire.write((byte)dec2bcd(timeVals->y));
-    } else {
-      if(timeVals->tf == 1) {
-        clearTimeRegister(TwelveHrFormat);
-      } else {
-        clearTimeRegister(TwentyFourHrFormat);
-      }
-      Wire.endTransmission();
-      return false;
-    }
-  #else
-    Wire.send((byte)DS3231_SECONDS_REG);
-
-    // Setting seconds register
-    if(timeVals->ss <= 59 && timeVals->ss >= 0) {
-      Wire.send((byte)dec2bcd(timeVals->ss));
-    } else {
-      if(timeVals->tf == 1) {
-        clearTimeRegister(TwelveHrFormat);
-      } else {
-        clearTimeRegister(TwentyFourHrFormat);
-      }
-      Wire.endTransmission();
-      return false;
+      clearTimeRegister(TwentyFourHrFormat);
     }
+    return false;
+  }
 
-    // Setting minutes register
-    if(timeVals->mm <= 59 && timeVals->mm >= 0) {
-      Wire.send((byte)dec2bcd(timeVals->mm));
+  // Setting dates register
+  if(timeVals->d > 0 && timeVals->d <= 31) {
+    buf[4] = dec2bcd(timeVals->d);
+  } else {
+    if(timeVals->tf == 1) {
+      clearTimeRegister(TwelveHrFormat);
     } else {
-      if(timeVals->tf == 1) {
-        clearTimeRegister(TwelveHrFormat);
-      } else {
-        clearTimeRegister(TwentyFourHrFormat);
-      }
-      Wire.endTransmission();
-      return false;
+      clearTimeRegister(TwentyFourHrFormat);
     }
+    return false;
+  }
 
-    // Checking the time format
+  // Setting month and year register
+  if(timeVals->y >= 2000 && timeVals->y < 2100) {
+    timeVals->m = dec2bcd(timeVals->m) | 0x80;  // 10000000
+    timeVals->y = timeVals->y - 2000;
+    buf[5] = timeVals->m;
+    buf[6] = dec2bcd(timeVals->y);
+  } else if (timeVals->y >= 1900) {
+    timeVals->m = dec2bcd(timeVals->m) & 0x7F;  // 01111111
+    timeVals->y = timeVals->y - 1900;
+    buf[5] = timeVals->m;
+    buf[6] = dec2bcd(timeVals->y);
+  } else {
     if(timeVals->tf == 1) {
-      if(timeVals->md == 0 && timeVals->hh <= 12 && timeVals->hh >= 1) {
-        // Changed the bit 6 of Hours register to 1 to set 12Hr format and bit 5 of Hours register to 0 to set meridian to AM
-        timeVals->hh = dec2bcd(timeVals->hh) | 0x40;    // 01000000
-        timeVals->hh &= 0xDF; // 11011111
-        Wire.send((byte)timeVals->hh);
-      } else if(timeVals->md == 1 && timeVals->hh <= 12 && timeVals->hh >= 1) {
-        // Changed the bit 6 of Hours register to 1 to set 12Hr format and bit 5 of Hours register to 1 to set meridian to PM
-        timeVals->hh = dec2bcd(timeVals->hh) | 0x60;    // 01100000
-        Wire.send((byte)timeVals->hh);
-      } else {
-        if(timeVals->tf == 1) {
-          clearTimeRegister(TwelveHrFormat);
-        } else {
-          clearTimeRegister(TwentyFourHrFormat);
-        }
-        Wire.endTransmission();
-        return false;
-      }
+      clearTimeRegister(TwelveHrFormat);
     } else {
-      if(timeVals->hh <= 23 && timeVals->hh >= 0) {
-        // Changed the bit 6 of Hours register to 0 to set 24Hr format
-        timeVals->hh = dec2bcd(timeVals->hh) & 0xBF;  // 10111111
-        Wire.send((byte)timeVals->hh);
-      } else {
-        if(timeVals->tf == 1) {
-          clearTimeRegister(TwelveHrFormat);
-        } else {
-          clearTimeRegister(TwentyFourHrFormat);
-        }
-        Wire.endTransmission();
-        return false;
-      }
+      clearTimeRegister(TwentyFourHrFormat);
     }
+    return false;
+  }
 
-    // Setting day register
-    if(timeVals->day >= 1 && timeVals->day <= 7) {
-      Wire.send((byte)dec2bcd(timeVals->day));
-    } else {
-      if(timeVals->tf == 1) {
-        clearTimeRegister(TwelveHrFormat);
-      } else {
-        clearTimeRegister(TwentyFourHrFormat);
-      }
-      Wire.endTransmission();
-      return false;
-    }
+  return writeRegisters(DS3231_SECONDS_REG, buf, 7);
+};
 
-    // Setting dates register
-    if(timeVals->d > 0 && timeVals->d <= 31) {
-      Wire.send((byte)dec2bcd(timeVals->d));
-    } else {
-      if(timeVals->tf == 1) {
-        clearTimeRegister(TwelveHrFormat);
-      } else {
-        clearTimeRegister(TwentyFourHrFormat);
-      }
-      Wire.endTransmission();
-      return false;
-    }
+/**
+  Set Date and Time in a single transaction after validating every field
+**/
+boolean Himadri_DS3231::setDateTimeAtomic(const struct timeParameters* timeVals) {
+  DS3231_STATS_API(DS3231_API_SET_DATE_TIME_ATOMIC);
+  uint8_t buf[7];
 
-    // Setting month and year register
-    if(timeVals->y >= 2000 && timeVals->y < 2100) {
-      timeVals->m = dec2bcd(timeVals->m) | 0x80;    // 10000000
-      timeVals->y = timeVals->y - 2000;
-      Wire.send((byte)timeVals->m);
-      Wire.send((byte)dec2bcd(timeVals->y));
-    } else if (timeVals->y >= 1900) {
-      timeVals->m = dec2bcd(timeVals->m) & 0x7F;    // 01111111
-      timeVals->y = timeVals->y - 1900;
-      Wire.send((byte)timeVals->m);
-      Wire.send((byte)dec2bcd(timeVals->y));
-    } else {
-      if(timeVals->tf == 1) {
-        clearTimeRegister(TwelveHrFormat);
-      } else {
-        clearTimeRegister(TwentyFourHrFormat);
-      }
-      Wire.endTransmission();
-      return false;
-    }
-  #endif
+  if(encodeDateTime(timeVals, buf) == false) {
+    return false;
+  }
 
-  Wire.endTransmission();
-  return true;
+  return writeRegisters(DS3231_SECONDS_REG, buf, 7);
 };
 
 /**
   Set Seconds
 **/
 boolean Himadri_DS3231::setSeconds(uint8_t ss) {
-  Wire.beginTransmission(DS3231_ADDRESS);
-
-  #if (ARDUINO >= 100)
-    Wire.write((byte)DS3231_SECONDS_REG);
-
-    // Setting seconds register
-    if(ss <= 59 && ss >= 0) {
-      Wire.write((byte)dec2bcd(ss));
-    } else {
-      Wire.endTransmission();
-      return false;
-    }
-  #else
-    Wire.send((byte)DS3231_SECONDS_REG);
-
-    // Setting seconds register
-    if(ss <= 59 && ss >= 0) {
-      Wire.send((byte)dec2bcd(ss));
-    } else {
-      Wire.endTransmission();
-      return false;
-    }
-  #endif
+  DS3231_STATS_API(DS3231_API_SET_SECONDS);
+  // Setting seconds register
+  if(ss <= 59 && ss >= 0) {
+    ss = dec2bcd(ss);
+  } else {
+    return false;
+  }
 
-  Wire.endTransmission();
-  return true;
+  return writeRegisters(DS3231_SECONDS_REG, &ss, 1);
 };
 
 /**
   Set Minutes
 **/
 boolean Himadri_DS3231::setMinutes(uint8_t mm) {
-  Wire.beginTransmission(DS3231_ADDRESS);
-
-  #if (ARDUINO >= 100)
-    Wire.write((byte)DS3231_MINUTES_REG);
-
-    // Setting seconds register
-    if(mm <= 59 && mm >= 0) {
-      Wire.write((byte)dec2bcd(mm));
-    } else {
-      Wire.endTransmission();
-      return false;
-    }
-  #else
-    Wire.send((byte)DS3231_MINUTES_REG);
-
-    // Setting seconds register
-    if(mm <= 59 && mm >= 0) {
-      Wire.send((byte)dec2bcd(mm));
-    } else {
-      Wire.endTransmission();
-      return false;
-    }
-  #endif
+  DS3231_STATS_API(DS3231_API_SET_MINUTES);
+  // Setting minutes register
+  if(mm <= 59 && mm >= 0) {
+    mm = dec2bcd(mm);
+  } else {
+    return false;
+  }
 
-  Wire.endTransmission();
-  return true;
+  return writeRegisters(DS3231_MINUTES_REG, &mm, 1);
 };
 
 /**
   Set Hour by passing timeformat and meridian
 **/
 boolean Himadri_DS3231::setHour(uint8_t hh, boolean tf, boolean md) {
-  Wire.beginTransmission(DS3231_ADDRESS);
-
-  #if (ARDUINO >= 100)
-    Wire.write((byte)DS3231_HOUR_REG);
-
-    // Checking the time format
-    if(tf == true) {
-      if(md == false && hh <= 12 && hh >= 1) {
-        // Changed the bit 6 of Hours register to 1 to set 12Hr format and bit 5 of Hours register to 0 to set meridian to AM
-        hh = dec2bcd(hh) | 0x40;    // 01000000
-        hh &= 0xDF; // 11011111
-        Wire.write((byte)hh);
-      } else if(md == true && hh <= 12 && hh >= 1) {
-        // Changed the bit 6 of Hours register to 1 to set 12Hr format and bit 5 of Hours register to 1 to set meridian to PM
-        hh = dec2bcd(hh) | 0x60;    // 01100000
-        Wire.write((byte)hh);
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
+  DS3231_STATS_API(DS3231_API_SET_HOUR);
+  // Checking the time format
+  if(tf == true) {
+    if(md == false && hh <= 12 && hh >= 1) {
+      // Changed the bit 6 of Hours register to 1 to set 12Hr format and bit 5 of Hours register to 0 to set meridian to AM
+      hh = dec2bcd(hh) | 0x40;    // 01000000
+      hh &= 0xDF; // 11011111
+    } else if(md == true && hh <= 12 && hh >= 1) {
+      // Changed the bit 6 of Hours register to 1 to set 12Hr format and bit 5 of Hours register to 1 to set meridian to PM
+      hh = dec2bcd(hh) | 0x60;    // 01100000
     } else {
-      if(hh <= 23 && hh >= 0) {
-        // Changed the bit 6 of Hours register to 0 to set 24Hr format
-        hh = dec2bcd(hh) & 0xBF;  // 10111111
-        Wire.write((byte)hh);
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
+      return false;
     }
-  #else
-    Wire.send((byte)DS3231_HOUR_REG);
-
-    // Checking the time format
-    if(tf == true) {
-      if(md == false && hh <= 12 && hh >= 1) {
-        // Changed the bit 6 of Hours register to 1 to set 12Hr format and bit 5 of Hours register to 0 to set meridian to AM
-        hh = dec2bcd(hh) | 0x40;    // 01000000
-        hh &= 0xDF; // 11011111
-        Wire.send((byte)hh);
-      } else if(md == true && hh <= 12 && hh >= 1) {
-        // Changed the bit 6 of Hours register to 1 to set 12Hr format and bit 5 of Hours register to 1 to set meridian to PM
-        hh = dec2bcd(hh) | 0x60;    // 01100000
-        Wire.send((byte)hh);
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
+  } else {
+    if(hh <= 23 && hh >= 0) {
+      // Changed the bit 6 of Hours register to 0 to set 24Hr format
+      hh = dec2bcd(hh) & 0xBF;  // 10111111
     } else {
-      if(hh <= 23 && hh >= 0) {
-        // Changed the bit 6 of Hours register to 0 to set 24Hr format
-        hh = dec2bcd(hh) & 0xBF;  // 10111111
-        Wire.send((byte)hh);
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
+      return false;
     }
-  #endif
+  }
 
-  Wire.endTransmission();
-  return true;
+  return writeRegisters(DS3231_HOUR_REG, &hh, 1);
 };
 
 /**
   Set Day of the week
 **/
 boolean Himadri_DS3231::setDay(uint8_t day) {
-  Wire.beginTransmission(DS3231_ADDRESS);
-
-  #if (ARDUINO >= 100)
-    Wire.write((byte)DS3231_DAY_REG);
-
-    // Setting day register
-    if(day >= 1 && day <= 7) {
-      Wire.write((byte)dec2bcd(day));
-    } else {
-      Wire.endTransmission();
-      return false;
-    }
-  #else
-    Wire.send((byte)DS3231_DAY_REG);
-
-    // Setting day register
-    if(day >= 1 && day <= 7) {
-      Wire.send((byte)dec2bcd(day));
-    } else {
-      Wire.endTransmission();
-      return false;
-    }
-  #endif
+  DS3231_STATS_API(DS3231_API_SET_DAY);
+  // Setting day register
+  if(day >= 1 && day <= 7) {
+    day = dec2bcd(day);
+  } else {
+    return false;
+  }
 
-  Wire.endTransmission();
-  return true;
+  return writeRegisters(DS3231_DAY_REG, &day, 1);
 };
 
 /**
   Set Date of the month
 **/
 boolean Himadri_DS3231::setDate(uint8_t date) {
-  uint8_t month = readRegister(DS3231_MONTH_REG);
+  DS3231_STATS_API(DS3231_API_SET_DATE);
+  uint8_t buf[2];
   uint16_t year = 0;
-  if((month & 0x80) >> 7 == 1) {            // 10000000
-    year = 2000 + readRegister(DS3231_YEAR_REG);
-    month = bcd2dec(month & 0x7F);          // 01111111
+  uint8_t month;
+
+  // Month and Year Register in a single transaction
+  if(readRegisters(DS3231_MONTH_REG, buf, 2) == false) {
+    return false;
+  }
+  if((buf[0] & 0x80) >> 7 == 1) {          // 10000000
+    year = 2000 + bcd2dec(buf[1]);
   } else {
-    year = 1900 + readRegister(DS3231_YEAR_REG);
-    month = bcd2dec(month & 0x7F);          // 01111111
+    year = 1900 + bcd2dec(buf[1]);
   }
+  month = bcd2dec(buf[0] & 0x7F);           // 01111111
 
   if(monthDateYearValidation(date, month, year) == false) {
     return false;
   }
 
-  Wire.beginTransmission(DS3231_ADDRESS);
+  // Setting date register
+  if(date >= 1 && date <= 31) {
+    date = dec2bcd(date);
+  } else {
+    return false;
+  }
 
-  #if (ARDUINO >= 100)
-    Wire.write((byte)DS3231_DATE_REG);
+  return writeRegisters(DS3231_DATE_REG, &date, 1);
+};
 
-    // Setting date register
-    if(date >= 1 && date <= 31) {
-      Wire.write((byte)dec2bcd(date));
+/**
+  Set Month of the Year
+**/
+boolean Himadri_DS3231::setMonth(uint8_t month, boolean century) {
+  DS3231_STATS_API(DS3231_API_SET_MONTH);
+  // Setting month register
+  if(month >= 1 && month <= 12) {
+    if(century == true) {
+      month = dec2bcd(month) | 0x80;        // 10000000
     } else {
-      Wire.endTransmission();
-      return false;
+      month = dec2bcd(month) & 0x7F;        // 01111111
     }
-  #else
-    Wire.send((byte)DS3231_DATE_REG);
+  } else {
+    return false;
+  }
 
-    // Setting date register
-    if(date >= 1 && date <= 31) {
-      Wire.send((byte)dec2bcd(date));
-    } else {
-      Wire.endTransmission();
-      return false;
-    }
-  #endif
+  return writeRegisters(DS3231_MONTH_REG, &month, 1);
+};
 
-  Wire.endTransmission();
-  return true;
+/**
+  Set Year
+**/
+boolean Himadri_DS3231::setYear(uint16_t year) {
+  DS3231_STATS_API(DS3231_API_SET_YEAR);
+  uint8_t buf[2];
+
+  if(year < 1900 || year > 2099) {
+    return false;
+  }
+  if(readRegisters(DS3231_MONTH_REG, buf, 1) == false) {
+    return false;
+  }
+  // Setting month and year register in a single transaction
+  if(year >= 2000) {
+    buf[0] |= 0x80;                           // 10000000
+    year = year - 2000;
+  } else {
+    buf[0] &= 0x7F;                           // 01111111
+    year = year - 1900;
+  }
+  buf[1] = dec2bcd(year);
+
+  return writeRegisters(DS3231_MONTH_REG, buf, 2);
 };
 
 /**
-  Set Month of the Year
+  Write the fields collected by a setter transaction.
 **/
-boolean Himadri_DS3231::setMonth(uint8_t month, boolean century = true) {
-  Wire.beginTransmission(DS3231_ADDRESS);
+boolean Himadri_DS3231::commit(const Himadri_DS3231_Transaction& tx) {
+  DS3231_STATS_API(DS3231_API_COMMIT);
+  const uint8_t dateMonthYear = (1 << DS3231_DATE_REG) | (1 << DS3231_MONTH_REG) | (1 << DS3231_YEAR_REG);
+  uint8_t dirty = tx.dirty & 0x7F;            // 01111111
+  uint8_t buf[7];
+  uint8_t chip[3];
+  uint8_t date = tx.d;
+  uint8_t month = tx.m;
+  uint16_t year = tx.y;
+  boolean century = tx.cy;
+
+  if(dirty == 0) {
+    return true;
+  }
 
-  #if (ARDUINO >= 100)
-    Wire.write((byte)DS3231_MONTH_REG);
+  if(((dirty & (1 << DS3231_SECONDS_REG)) && tx.ss > 59) ||
+    ((dirty & (1 << DS3231_MINUTES_REG)) && tx.mm > 59) ||
+    ((dirty & (1 << DS3231_DAY_REG)) && (tx.dy < 1 || tx.dy > 7)) ||
+    ((dirty & (1 << DS3231_MONTH_REG)) && (tx.m < 1 || tx.m > 12)) ||
+    ((dirty & (1 << DS3231_YEAR_REG)) && (tx.y < 1900 || tx.y > 2099))) {
+    return false;
+  }
+  if((dirty & (1 << DS3231_HOUR_REG)) && encodeAlarmHour(tx.hh, tx.tf, tx.md, &buf[DS3231_HOUR_REG]) == false) {
+    return false;
+  }
 
-    // Setting day register
-    if(month >= 1 && month <= 12) {
-      if(century == true) {
-        Wire.write((byte)dec2bcd(month) | 0x80);        // 10000000
-      } else {
-        Wire.write((byte)dec2bcd(month) & 0x7F);        // 01111111
-      }
-    } else {
-      Wire.endTransmission();
+  // The resulting date is checked, so the unchanged ones of Date / Month / Year come from the chip
+  if((dirty & dateMonthYear) != 0 && (dirty & dateMonthYear) != dateMonthYear) {
+    if(readRegisters(DS3231_DATE_REG, chip, 3) == false) {
       return false;
     }
-  #else
-    Wire.send((byte)DS3231_MONTH_REG);
+    if((dirty & (1 << DS3231_DATE_REG)) == 0) {
+      date = bcd2dec(chip[0]);
+    }
+    if((dirty & (1 << DS3231_MONTH_REG)) == 0) {
+      month = bcd2dec(chip[1] & 0x1F);        // 00011111
+      century = (chip[1] & 0x80) != 0;        // 10000000
+    }
+    if((dirty & (1 << DS3231_YEAR_REG)) == 0) {
+      year = (century ? 2000 : 1900) + bcd2dec(chip[2]);
+    }
+  }
+  // The century bit of the year lives in the Month Register
+  if(dirty & (1 << DS3231_YEAR_REG)) {
+    century = year >= 2000;
+    dirty |= 1 << DS3231_MONTH_REG;
+  }
 
-    // Setting day register
-    if(month >= 1 && month <= 12) {
-      if(century == true) {
-        Wire.send((byte)dec2bcd(month) | 0x80);        // 10000000
-      } else {
-        Wire.send((byte)dec2bcd(month) & 0x7F);        // 01111111
-      }
-    } else {
-      Wire.endTransmission();
+  if((dirty & dateMonthYear) && monthDateYearValidation(date, month, year) == false) {
+    return false;
+  }
+
+  buf[DS3231_SECONDS_REG] = dec2bcd(tx.ss);
+  buf[DS3231_MINUTES_REG] = dec2bcd(tx.mm);
+  buf[DS3231_DAY_REG] = dec2bcd(tx.dy);
+  buf[DS3231_DATE_REG] = dec2bcd(date);
+  buf[DS3231_MONTH_REG] = dec2bcd(month) | (century ? 0x80 : 0x00);    // 10000000
+  buf[DS3231_YEAR_REG] = dec2bcd(year - (century ? 2000 : 1900));
+
+  // One burst per run of consecutive changed registers
+  for(uint8_t first = 0; first < 7; first++) {
+    if((dirty & (1 << first)) == 0) {
+      continue;
+    }
+    uint8_t last = first;
+    while(last + 1 < 7 && (dirty & (1 << (last + 1)))) {
+      last++;
+    }
+    if(writeRegisters(DS3231_SECONDS_REG + first, buf + first, last - first + 1) == false) {
       return false;
     }
-  #endif
+    first = last;
+  }
 
-  Wire.endTransmission();
   return true;
 };
 
 /**
-  Set Year
+  Get current Date and Time
 **/
-boolean Himadri_DS3231::setYear(uint16_t year) {
-  // Setting month and year register
-  if(year >= 2000 && year < 2100) {
-    uint8_t month = readRegister(DS3231_MONTH_REG);
-    writeRegister(DS3231_MONTH_REG, (month | 0x80));          // 10000000
-    year = year - 2000;
-    writeRegister(DS3231_YEAR_REG, dec2bcd(year));
-  } else if (year >= 1900) {
-    uint8_t month = readRegister(DS3231_MONTH_REG);
-    writeRegister(DS3231_MONTH_REG, (month & 0x7F));          // 10000000
-    year = year - 1900;
-    writeRegister(DS3231_YEAR_REG, dec2bcd(year));
-  } else {
+boolean Himadri_DS3231::readDateTime(struct timeParameters* timeVals) {
+  DS3231_STATS_API(DS3231_API_READ_DATE_TIME);
+  uint8_t buf[7];
+
+  if(readRegisters(DS3231_SECONDS_REG, buf, 7) == false) {
     return false;
   }
+  decodeDateTime(buf, timeVals);
 
   return true;
 };
 
 /**
-  Get current Date and Time
+  Get current Date and Time as seconds since 1970/01/01 00:00:00
 **/
-boolean Himadri_DS3231::readDateTime(struct timeParameters* timeVals) {
-  Wire.beginTransmission(DS3231_ADDRESS);
+boolean Himadri_DS3231::readEpoch(uint32_t* epoch) {
+  DS3231_STATS_API(DS3231_API_READ_EPOCH);
+  uint8_t buf[7];
+  int32_t days;
+  uint32_t secs;
 
-  #if (ARDUINO >= 100)
-    Wire.write(DS3231_SECONDS_REG);
-  #else
-    Wire.send(DS3231_SECONDS_REG);
-  #endif
-  Wire.endTransmission();
-
-  Wire.requestFrom(DS3231_ADDRESS, 7, true);
-
-  #if (ARDUINO >= 100)
-    timeVals->ss = bcd2dec(Wire.read());
-    timeVals->mm = bcd2dec(Wire.read());
-    timeVals->hh = Wire.read();
-    if((timeVals->hh & 0x40) >> 6 == 1) {
-      timeVals->tf = 1;
-      if((timeVals->hh & 0x20) >> 5 == 1) {           // 00100000
-        timeVals->md = 1;
-      } else {
-        timeVals->md = 0;
-      }
-      timeVals->hh = bcd2dec(timeVals->hh & 0x1F);    // 00011111
-    } else {
-      timeVals->hh = bcd2dec(Wire.read() & 0x3F);     // 00111111
-    }
-    timeVals->day = bcd2dec(Wire.read());
-    timeVals->d = bcd2dec(Wire.read());
-    timeVals->m = Wire.read();
-    timeVals->y = bcd2dec(Wire.read());
-    if((timeVals->m & 0x80) >> 7 == 1) {            // 10000000
-      timeVals->y = 2000 + timeVals->y;
-      timeVals->m = bcd2dec(timeVals->m & 0x7F);    // 01111111
-    } else {
-      timeVals->y = 1900 + timeVals->y;
-      timeVals->m = bcd2dec(timeVals->m & 0x7F);    // 01111111
-    }
-  #else
-    timeVals->ss = bcd2dec(Wire.receive());
-    timeVals->mm = bcd2dec(Wire.receive());
-    timeVals->hh = Wire.receive();
-    if((alarmVals->hh & 0x40) >> 6 == 1) {
-      timeVals->tf = 1;
-      if((timeVals->hh & 0x20) >> 5 == 1) {           // 00100000
-        timeVals->md = 1;
-      } else {
-        timeVals->md = 0;
-      }
-      timeVals->hh = bcd2dec(timeVals->hh & 0x1F);    // 00011111
-    } else {
-      timeVals->hh = bcd2dec(Wire.read() & 0x3F);     // 00111111
-    }
-    timeVals->day = bcd2dec(Wire.receive());
-    timeVals->d = bcd2dec(Wire.receive());
-    timeVals->m = Wire.receive();
-    timeVals->y = bcd2dec(Wire.receive());
-    if((timeVals->m & 0x80) >> 7 == 1) {            // 10000000
-      timeVals->y = 2000 + timeVals->y;
-      timeVals->m = bcd2dec(timeVals->m & 0x7F);    // 01111111
-    } else {
-      timeVals->y = 1900 + timeVals->y;
-      timeVals->m = bcd2dec(timeVals->m & 0x7F);    // 01111111
+  if(readRegisters(DS3231_SECONDS_REG, buf, 7) == false) {
+    return false;
+  }
+  decodeEpoch(buf, &days, &secs);
+  if(days < 0) {
+    return false;
+  }
+  *epoch = (uint32_t)days * 86400UL + secs;
+
+  return true;
+};
+
+/**
+  Set Date and Time from seconds since 1970/01/01 00:00:00
+**/
+boolean Himadri_DS3231::setEpoch(uint32_t epoch, uint8_t timeFormat) {
+  DS3231_STATS_API(DS3231_API_SET_EPOCH);
+  uint8_t buf[7];
+
+  if(epoch > DS3231_EPOCH_MAX) {
+    return false;
+  }
+  encodeEpoch(epoch / 86400UL, epoch % 86400UL, timeFormat, buf);
+
+  return writeRegisters(DS3231_SECONDS_REG, buf, 7);
+};
+
+/**
+  Get current Date and Time as signed seconds since 1970/01/01 00:00:00
+**/
+boolean Himadri_DS3231::readEpoch64(int64_t* epoch) {
+  DS3231_STATS_API(DS3231_API_READ_EPOCH64);
+  uint8_t buf[7];
+  int32_t days;
+  uint32_t secs;
+
+  if(readRegisters(DS3231_SECONDS_REG, buf, 7) == false) {
+    return false;
+  }
+  decodeEpoch(buf, &days, &secs);
+  *epoch = (int64_t)days * 86400 + secs;
+
+  return true;
+};
+
+/**
+  Set Date and Time from signed seconds since 1970/01/01 00:00:00
+**/
+boolean Himadri_DS3231::setEpoch64(int64_t epoch, uint8_t timeFormat) {
+  DS3231_STATS_API(DS3231_API_SET_EPOCH64);
+  uint8_t buf[7];
+
+  if(epoch < DS3231_EPOCH64_MIN || epoch > (int64_t)DS3231_EPOCH_MAX) {
+    return false;
+  }
+  // Floor division so the seconds of the day stay positive before 1970
+  int32_t days = (int32_t)(epoch / 86400);
+  int32_t secs = (int32_t)(epoch % 86400);
+  if(secs < 0) {
+    secs = secs + 86400;
+    days = days - 1;
+  }
+  encodeEpoch(days, (uint32_t)secs, timeFormat, buf);
+
+  return writeRegisters(DS3231_SECONDS_REG, buf, 7);
+};
+
+/**
+  Set Date and Time so the next second of the reference starts on its boundary
+**/
+boolean Himadri_DS3231::setEpochAligned(uint32_t epoch, uint32_t phase, struct syncParameters* syncVals,
+  uint8_t timeFormat) {
+  DS3231_STATS_API(DS3231_API_SET_EPOCH_ALIGNED);
+  unsigned long boundary = micros() + (1000000UL - phase);
+  unsigned long start, lead, elapsed;
+  uint8_t buf[7];
+
+  if(phase >= 1000000UL || epoch >= DS3231_EPOCH_MAX) {
+    return false;
+  }
+
+  // Time a read of the 7 timekeeping registers to measure the bus speed. The read
+  // takes 94 bits, the write acknowledges the Seconds Register after 28 of its 83 bits
+  start = micros();
+  if(readRegisters(DS3231_SECONDS_REG, buf, 7) == false) {
+    return false;
+  }
+  lead = (micros() - start) * 28 / 94;
+
+  // Too late to start the write before this boundary, take the next one
+  epoch = epoch + 1;
+  if((long)(boundary - lead - micros()) < 0) {
+    boundary = boundary + 1000000UL;
+    epoch = epoch + 1;
+    if(epoch > DS3231_EPOCH_MAX) {
+      return false;
     }
-  #endif
+  }
+  encodeEpoch(epoch / 86400UL, epoch % 86400UL, timeFormat, buf);
+
+  while((long)(boundary - lead - micros()) > 0) {
+    unsigned long remaining = boundary - lead - micros();
+    delayMicroseconds(remaining > 10000UL ? 10000U : (unsigned int)remaining);
+  }
+
+  start = micros();
+  if(writeRegisters(DS3231_SECONDS_REG, buf, 7) == false) {
+    return false;
+  }
+  elapsed = micros() - start;
+
+  if(syncVals != NULL) {
+    syncVals->leadMicros = lead;
+    syncVals->writeMicros = elapsed;
+    syncVals->errorMicros = (long)(start + elapsed * 28 / 83 - boundary);
+  }
+
+  return true;
+};
+
+/**
+  Get date and time, both alarms, control, status, aging and temperature
+  by reading all the registers 0x00 - 0x12 in a single transaction
+**/
+boolean Himadri_DS3231::readSnapshot(struct snapshotParameters* snapVals) {
+  DS3231_STATS_API(DS3231_API_READ_SNAPSHOT);
+  uint8_t buf[DS3231_REGISTER_COUNT];
+
+  if(readRegisters(DS3231_SECONDS_REG, buf, DS3231_REGISTER_COUNT) == false) {
+    return false;
+  }
+
+  decodeDateTime(buf, &snapVals->time);
+
+  snapVals->alarm1.ss = bcd2dec(buf[DS3231_AL1SEC_REG] & 0x7F);    // 01111111
+  decodeAlarm(buf + DS3231_AL1MIN_REG, &snapVals->alarm1);
+  snapVals->alarm2.ss = 0;
+  decodeAlarm(buf + DS3231_AL2MIN_REG, &snapVals->alarm2);
+
+  snapVals->control = buf[DS3231_CONTROL_REG];
+  snapVals->status = buf[DS3231_STATUS_REG];
+  ctRegShadow = snapVals->control;
+  statusRegShadow = snapVals->status;
+  shadowValid = true;
+  snapVals->aging = (int8_t)buf[DS3231_AGING_REG];
+  snapVals->temp = decodeTemp(buf[DS3231_TEMPERATURE_MSG_REG], buf[DS3231_TEMPERATURE_LSB_REG]);
 
   return true;
 };
@@ -899,408 +1350,166 @@ boolean Himadri_DS3231::readDateTime(struct timeParameters* timeVals) {
   Set Alaram on every period of Seconds / Minutes / Hour
 **/
 boolean Himadri_DS3231::setAlarm(uint8_t periodicity, uint8_t alarm) {
-  Wire.beginTransmission(DS3231_ADDRESS);
+  DS3231_STATS_API(DS3231_API_SET_ALARM);
+  uint8_t buf[4];
+  uint8_t regaddress;
+  uint8_t len = 0;
+
+  if(alarm == 1) {
+    regaddress = DS3231_AL1SEC_REG;
+  } else if(alarm == 2 && periodicity != Second) {
+    regaddress = DS3231_AL2MIN_REG;
+  } else {
+    return false;
+  }
+
   switch(periodicity)
   {
       case Second:
-        #if (ARDUINO >= 100)
-          if(alarm == 1) {
-            Wire.write((byte)DS3231_AL1SEC_REG);
-            Wire.write(128);                                   // 10000000
-            Wire.write(128);                                   // 10000000
-            Wire.write(128);                                   // 10000000
-            Wire.write(128);                                   // 10000000
-          } else {
-            Wire.endTransmission();
-            return false;
-          }
-        #else
-          if(alarm == 1) {
-            Wire.send((byte)DS3231_AL1SEC_REG);
-            Wire.send(128);                                    // 10000000
-            Wire.send(128);                                    // 10000000
-            Wire.send(128);                                    // 10000000
-            Wire.send(128);                                    // 10000000
-          } else {
-            Wire.endTransmission();
-            return false;
-          }
-        #endif
+        buf[len++] = 128;                                 // 10000000
+        buf[len++] = 128;                                 // 10000000
+        buf[len++] = 128;                                 // 10000000
+        buf[len++] = 128;                                 // 10000000
       break;
       case Minute:
-        #if (ARDUINO >= 100)
-          if(alarm == 1) {
-            Wire.write((byte)DS3231_AL1SEC_REG);
-            Wire.write(0);                                     // 00000000
-          } else if(alarm == 2) {
-            Wire.write((byte)DS3231_AL2MIN_REG);
-          } else {
-            Wire.endTransmission();
-            return false;
-          }
-          Wire.write(128);                                    // 10000000
-          Wire.write(128);                                    // 10000000
-          Wire.write(128);                                    // 10000000
-        #else
-          if(alarm == 1) {
-            Wire.write((byte)DS3231_AL1SEC_REG);
-            Wire.send(0);                                     // 00000000
-          } else if(alarm == 2) {
-            Wire.write((byte)DS3231_AL2MIN_REG);
-          } else {
-            Wire.endTransmission();
-            return false;
-          }
-          Wire.send(128);                                     // 10000000
-          Wire.send(128);                                     // 10000000
-          Wire.send(128);                                     // 10000000
-        #endif
+        if(alarm == 1) {
+          buf[len++] = 0;                                 // 00000000
+        }
+        buf[len++] = 128;                                 // 10000000
+        buf[len++] = 128;                                 // 10000000
+        buf[len++] = 128;                                 // 10000000
       break;
       case Hour:
-        #if (ARDUINO >= 100)
-          if(alarm == 1) {
-            Wire.write((byte)DS3231_AL1SEC_REG);
-            Wire.write(0);                                   // 00000000
-          } else if(alarm == 2) {
-            Wire.write((byte)DS3231_AL2MIN_REG);
-          } else {
-            Wire.endTransmission();
-            return false;
-          }
-          Wire.write(0);                                     // 00000000
-          Wire.write(128);                                   // 10000000
-          Wire.write(128);                                   // 10000000
-        #else
-          if(alarm == 1) {
-            Wire.write((byte)DS3231_AL1SEC_REG);
-            Wire.write(0);                                  // 00000000
-          } else if(alarm == 2) {
-            Wire.write((byte)DS3231_AL2MIN_REG);
-          } else {
-            Wire.endTransmission();
-            return false;
-          }
-          Wire.send(0);                                      // 00000000
-          Wire.send(128);                                    // 10000000
-          Wire.send(128);                                    // 10000000
-        #endif
+        if(alarm == 1) {
+          buf[len++] = 0;                                 // 00000000
+        }
+        buf[len++] = 0;                                   // 00000000
+        buf[len++] = 128;                                 // 10000000
+        buf[len++] = 128;                                 // 10000000
       break;
       default:
-        Wire.endTransmission();
         return false;
       break;
   };
-  Wire.endTransmission();
-  return true;
+
+  return writeRegisters(regaddress, buf, len);
 };
 
 /**
   Set Alarm matching for exact Seconds / Minutes / Hour with time format and meridian
 **/
 boolean Himadri_DS3231::setAlarm(uint8_t periodicity, uint8_t val, boolean tf, boolean md, uint8_t alarm) {
-  Wire.beginTransmission(DS3231_ADDRESS);
+  DS3231_STATS_API(DS3231_API_SET_ALARM);
+  uint8_t buf[4];
+  uint8_t regaddress;
+  uint8_t len = 0;
+
+  if(alarm == 1) {
+    regaddress = DS3231_AL1SEC_REG;
+  } else if(alarm == 2 && periodicity != Second) {
+    regaddress = DS3231_AL2MIN_REG;
+  } else {
+    return false;
+  }
 
   switch(periodicity)
   {
       case Second:
-        #if (ARDUINO >= 100)
-          if(alarm == 1) {
-            if(val <= 59 && val >=0) {
-              Wire.write((byte)DS3231_AL1SEC_REG);
-              Wire.write((byte)dec2bcd(val) & 0x7F);             // 10000000
-              Wire.write(128);                                   // 10000000
-              Wire.write(128);                                   // 10000000
-              Wire.write(128);                                   // 10000000
-            } else {
-              Wire.endTransmission();
-              return false;
-            }
-          } else {
-            Wire.endTransmission();
-            return false;
-          }
-        #else
-        if(alarm == 1) {
-          if(val <= 59 && val >=0) {
-            Wire.send((byte)DS3231_AL1SEC_REG);
-            Wire.send((byte)dec2bcd(val) & 0x7F);             // 10000000
-            Wire.send(128);                                   // 10000000
-            Wire.send(128);                                   // 10000000
-            Wire.send(128);                                   // 10000000
-          } else {
-            Wire.endTransmission();
-            return false;
-          }
+        if(val <= 59 && val >=0) {
+          buf[len++] = dec2bcd(val) & 0x7F;               // 01111111
+          buf[len++] = 128;                               // 10000000
+          buf[len++] = 128;                               // 10000000
+          buf[len++] = 128;                               // 10000000
         } else {
-          Wire.endTransmission();
           return false;
         }
-        #endif
       break;
       case Minute:
-        #if (ARDUINO >= 100)
-          if(val <= 59 && val >=0) {
-            if(alarm == 1) {
-              Wire.write((byte)DS3231_AL1SEC_REG);
-              Wire.write(0);                                      // 00000000
-            } else if(alarm == 2) {
-              Wire.write((byte)DS3231_AL2MIN_REG);
-            } else {
-              Wire.endTransmission();
-              return false;
-            }
-            Wire.write((byte)dec2bcd(val) & 0x7F);              // 10000000
-            Wire.write(128);                                    // 10000000
-            Wire.write(128);                                    // 10000000
-          } else {
-            Wire.endTransmission();
-            return false;
-          }
-        #else
-          if(val <= 59 && val >=0) {
-            if(alarm == 1) {
-              Wire.send((byte)DS3231_AL1SEC_REG);
-              Wire.send(0);                                      // 00000000
-            } else if(alarm == 2) {
-              Wire.send((byte)DS3231_AL2MIN_REG);
-            } else {
-              Wire.endTransmission();
-              return false;
-            }
-            Wire.send((byte)dec2bcd(val) & 0x7F);              // 10000000
-            Wire.send(128);                                    // 10000000
-            Wire.send(128);                                    // 10000000
-          } else {
-            Wire.endTransmission();
-            return false;
-          }
-        #endif
-      break;
-      case Hour:
-        #if (ARDUINO >= 100)
-          if(alarm == 1) {
-            Wire.write((byte)DS3231_AL1SEC_REG);
-            Wire.write(0);                                     // 00000000
-          } else if(alarm == 2) {
-            Wire.write((byte)DS3231_AL2MIN_REG);
-          } else {
-            Wire.endTransmission();
-            return false;
-          }
-          Wire.write(0);                                        // 00000000
-          if(tf == true && md == true) {
-            if(val <= 12 && val >=1) {
-              Wire.write((byte)dec2bcd(val) & 0x7F | 0x60);    // 01111111 | 01100000
-            } else {
-              Wire.endTransmission();
-              return false;
-            }
-          } else if(tf == true && md == false) {
-            if(val <= 12 && val >=1) {
-              Wire.write((byte)dec2bcd(val) & 0x5F | 0x40);    // 01011111 | 01000000
-            } else {
-              Wire.endTransmission();
-              return false;
-            }
-          } else {
-            if(val <= 23 && val >=0) {
-              Wire.write((byte)dec2bcd(val) & 0x3F);           // 00111111
-            } else {
-              Wire.endTransmission();
-              return false;
-            }
-          }
-          Wire.write(128);                                   // 10000000
-        #else
+        if(val <= 59 && val >=0) {
           if(alarm == 1) {
-            Wire.send((byte)DS3231_AL1SEC_REG);
-            Wire.send(0);                                     // 00000000
-          } else if(alarm == 2) {
-            Wire.send((byte)DS3231_AL2MIN_REG);
-          } else {
-            Wire.endTransmission();
-            return false;
-          }
-          Wire.send(0);                                        // 00000000
-          if(tf == true && md == true) {
-            if(val <= 12 && val >=1) {
-              Wire.send((byte)dec2bcd(val) & 0x7F | 0x60);    // 01111111 | 01100000
-            } else {
-              Wire.endTransmission();
-              return false;
-            }
-          } else if(tf == true && md == false) {
-            if(val <= 12 && val >=1) {
-              Wire.send((byte)dec2bcd(val) & 0x5F | 0x40);    // 01011111 | 01000000
-            } else {
-              Wire.endTransmission();
-              return false;
-            }
-          } else {
-            if(val <= 23 && val >=0) {
-              Wire.send((byte)dec2bcd(val) & 0x3F);           // 00111111
-            } else {
-              Wire.endTransmission();
-              return false;
-            }
+            buf[len++] = 0;                               // 00000000
           }
-          Wire.send(128);                                   // 10000000
-        #endif
-      break;
-      default:
-        Wire.endTransmission();
-        return false;
+          buf[len++] = dec2bcd(val) & 0x7F;               // 01111111
+          buf[len++] = 128;                               // 10000000
+          buf[len++] = 128;                               // 10000000
+        } else {
+          return false;
+        }
       break;
-  };
-  Wire.endTransmission();
-  return true;
-};
-
-/**
-  Set Alarm matching for exact Seconds and Minutes
-**/
-boolean Himadri_DS3231::setAlarm(uint8_t ss, uint8_t mm, uint8_t alarm) {
-  Wire.beginTransmission(DS3231_ADDRESS);
-
-  #if (ARDUINO >= 100)
-    if(alarm == 1) {
-      Wire.write((byte)DS3231_AL1SEC_REG);
-
-      if(ss <= 59 && ss >= 0 && mm <= 59 && mm >= 0) {
-        Wire.write((byte)dec2bcd(ss) & 0x7F);             // 01111111
-        Wire.write((byte)dec2bcd(mm) & 0x7F);             // 01111111
-        Wire.write(128);                                  // 10000000
-        Wire.write(128);                                  // 10000000
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
-    } else {
-      Wire.endTransmission();
-      return false;
-    }
-  #else
-    if(alarm == 1) {
-      Wire.send((byte)DS3231_AL1SEC_REG);
-
-      if(ss <= 59 && ss >= 0 && mm <= 59 && mm >= 0) {
-        Wire.send((byte)dec2bcd(ss) & 0x7F);             // 01111111
-        Wire.send((byte)dec2bcd(mm) & 0x7F);             // 01111111
-        Wire.send(128);                                  // 10000000
-        Wire.send(128);                                  // 10000000
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
-    } else {
-      Wire.endTransmission();
-      return false;
-    }
-  #endif
-  Wire.endTransmission();
-  return true;
-};
-
-/**
-  Set Alaram matching seconds, minutes and hour
-*/
-boolean Himadri_DS3231::setAlarm(uint8_t ss, uint8_t mm, uint8_t hh, boolean tf, boolean md, uint8_t alarm) {
-  Wire.beginTransmission(DS3231_ADDRESS);
-
-  #if (ARDUINO >= 100)
-    if(alarm == 1) {
-      Wire.write((byte)DS3231_AL1SEC_REG);
-      if(ss <= 59 && ss >= 0) {
-        Wire.write((byte)dec2bcd(ss) & 0x7F);                // 01111111
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
-    } else if(alarm == 2) {
-      Wire.write((byte)DS3231_AL2MIN_REG);
-    } else {
-      Wire.endTransmission();
-      return false;
-    }
-
-    if(mm <= 59 && mm >= 0) {
-      Wire.write((byte)dec2bcd(mm) & 0x7F);                // 01111111
-    } else {
-      Wire.endTransmission();
-      return false;
-    }
-    if(tf == true && md == true) {
-      if(hh <= 12 && hh >=1) {
-        Wire.write((byte)dec2bcd(hh) & 0x7F | 0x60);     // 01111111 | 01100000
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
-    } else if(tf == true && md == false) {
-      if(hh <= 12 && hh >=1) {
-        Wire.write((byte)dec2bcd(hh) & 0x5F | 0x40);     // 01011111 | 01000000
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
-    } else {
-      if(hh <= 23 && hh >=0) {
-        Wire.write((byte)dec2bcd(hh) & 0x3F);            // 00111111
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
-    }
-    Wire.write(128);                                       // 10000000
-  #else
-    if(alarm == 1) {
-      Wire.send((byte)DS3231_AL1SEC_REG);
-      if(ss <= 59 && ss >= 0) {
-        Wire.send((byte)dec2bcd(ss) & 0x7F);                // 01111111
-      } else {
-        Wire.endTransmission();
+      case Hour:
+        if(alarm == 1) {
+          buf[len++] = 0;                                 // 00000000
+        }
+        buf[len++] = 0;                                   // 00000000
+        if(encodeAlarmHour(val, tf, md, &buf[len++]) == false) {
+          return false;
+        }
+        buf[len++] = 128;                                 // 10000000
+      break;
+      default:
         return false;
-      }
-    } else if(alarm == 2) {
-      Wire.send((byte)DS3231_AL2MIN_REG);
+      break;
+  };
+
+  return writeRegisters(regaddress, buf, len);
+};
+
+/**
+  Set Alarm matching for exact Seconds and Minutes
+**/
+boolean Himadri_DS3231::setAlarm(uint8_t ss, uint8_t mm, uint8_t alarm) {
+  DS3231_STATS_API(DS3231_API_SET_ALARM);
+  uint8_t buf[4];
+
+  if(alarm == 1) {
+    if(ss <= 59 && ss >= 0 && mm <= 59 && mm >= 0) {
+      buf[0] = dec2bcd(ss) & 0x7F;              // 01111111
+      buf[1] = dec2bcd(mm) & 0x7F;              // 01111111
+      buf[2] = 128;                             // 10000000
+      buf[3] = 128;                             // 10000000
     } else {
-      Wire.endTransmission();
       return false;
     }
+  } else {
+    return false;
+  }
+
+  return writeRegisters(DS3231_AL1SEC_REG, buf, 4);
+};
+
+/**
+  Set Alaram matching seconds, minutes and hour
+*/
+boolean Himadri_DS3231::setAlarm(uint8_t ss, uint8_t mm, uint8_t hh, boolean tf, boolean md, uint8_t alarm) {
+  DS3231_STATS_API(DS3231_API_SET_ALARM);
+  uint8_t buf[4];
+  uint8_t regaddress;
+  uint8_t len = 0;
 
-    if(mm <= 59 && mm >= 0) {
-      Wire.send((byte)dec2bcd(mm) & 0x7F);                // 01111111
+  if(alarm == 1) {
+    regaddress = DS3231_AL1SEC_REG;
+    if(ss <= 59 && ss >= 0) {
+      buf[len++] = dec2bcd(ss) & 0x7F;          // 01111111
     } else {
-      Wire.endTransmission();
       return false;
     }
-    if(tf == true && md == true) {
-      if(hh <= 12 && hh >=1) {
-        Wire.send((byte)dec2bcd(hh) & 0x7F | 0x60);     // 01111111 | 01100000
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
-    } else if(tf == true && md == false) {
-      if(hh <= 12 && hh >=1) {
-        Wire.send((byte)dec2bcd(hh) & 0x5F | 0x40);     // 01011111 | 01000000
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
-    } else {
-      if(hh <= 23 && hh >=0) {
-        Wire.send((byte)dec2bcd(hh) & 0x3F);            // 00111111
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
-    }
-    Wire.write(128);                                       // 10000000
-  #endif
+  } else if(alarm == 2) {
+    regaddress = DS3231_AL2MIN_REG;
+  } else {
+    return false;
+  }
 
-  Wire.endTransmission();
-  return true;
+  if(mm <= 59 && mm >= 0) {
+    buf[len++] = dec2bcd(mm) & 0x7F;            // 01111111
+  } else {
+    return false;
+  }
+  if(encodeAlarmHour(hh, tf, md, &buf[len++]) == false) {
+    return false;
+  }
+  buf[len++] = 128;                             // 10000000
+
+  return writeRegisters(regaddress, buf, len);
 };
 
 /**
@@ -1308,155 +1517,129 @@ boolean Himadri_DS3231::setAlarm(uint8_t ss, uint8_t mm, uint8_t hh, boolean tf,
 **/
 boolean Himadri_DS3231::setAlarm(uint8_t ss, uint8_t mm, uint8_t hh,
   uint8_t dyDt, boolean dy, boolean tf, boolean md, uint8_t alarm) {
-  Wire.beginTransmission(DS3231_ADDRESS);
+  DS3231_STATS_API(DS3231_API_SET_ALARM);
+  uint8_t buf[4];
+  uint8_t regaddress;
+  uint8_t len = 0;
 
-  #if (ARDUINO >= 100)
-    if(alarm == 1) {
-      Wire.write((byte)DS3231_AL1SEC_REG);
-      if(ss <= 59 && ss >= 0) {
-        Wire.write((byte)dec2bcd(ss) & 0x7F);             // 01111111
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
-    } else if(alarm == 2) {
-      Wire.write((byte)DS3231_AL2MIN_REG);
+  if(alarm == 1) {
+    regaddress = DS3231_AL1SEC_REG;
+    if(ss <= 59 && ss >= 0) {
+      buf[len++] = dec2bcd(ss) & 0x7F;          // 01111111
     } else {
-      Wire.endTransmission();
       return false;
     }
+  } else if(alarm == 2) {
+    regaddress = DS3231_AL2MIN_REG;
+  } else {
+    return false;
+  }
 
-    if(mm <= 59 && mm >= 0) {
-      Wire.write((byte)dec2bcd(mm) & 0x7F);             // 01111111
-    } else {
-      Wire.endTransmission();
-      return false;
-    }
-    if(tf == true && md == true) {
-      if(hh <= 12 && hh >=1) {
-        Wire.write((byte)dec2bcd(hh) & 0x7F | 0x60);    // 01111111 | 01100000
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
-    } else if(tf == true && md == false) {
-      if(hh <= 12 && hh >=1) {
-        Wire.write((byte)dec2bcd(hh) & 0x5F | 0x40);    // 01011111 | 01000000
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
-    } else {
-      if(hh <= 23 && hh >=0) {
-        Wire.write((byte)dec2bcd(hh) & 0x3F);           // 00111111
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
-    }
-    if(dy == true) {
-      Wire.write((byte)dec2bcd(dyDt) & 0x7F | 0x40);  // 01111111 | 01000000
-    } else {
-      Wire.write((byte)dec2bcd(dyDt) & 0x3F);         // 00111111
-    }
-  #else
-    Wire.send((byte)DS3231_AL1SEC_REG);
-    if(ss <= 59 && ss >= 0 && mm <= 59 && mm >= 0) {
-      Wire.send((byte)dec2bcd(ss) & 0x7F);            // 01111111
-      Wire.send((byte)dec2bcd(mm) & 0x7F);            // 01111111
-    } else {
-      Wire.endTransmission();
-      return false;
-    }
-    if(tf == true && md == true) {
-      if(hh <= 12 && hh >=1) {
-        Wire.send((byte)dec2bcd(hh) & 0x7F | 0x60);    // 01111111 | 01100000
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
-    } else if(tf == true && md == false) {
-      if(hh <= 12 && hh >=1) {
-        Wire.send((byte)dec2bcd(hh) & 0x5F | 0x40);    // 01011111 | 01000000
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
-    } else {
-      if(hh <= 23 && hh >=0) {
-        Wire.send((byte)dec2bcd(hh) & 0x3F);           // 00111111
-      } else {
-        Wire.endTransmission();
-        return false;
-      }
-    }
-    if(dy == true) {
-      Wire.send((byte)dec2bcd(dyDt) & 0x7F | 0x40);  // 01111111 | 01000000
-    } else {
-      Wire.send((byte)dec2bcd(dyDt) & 0x3F);         // 00111111
-    }
-  #endif
-  Wire.endTransmission();
-  return true;
+  if(mm <= 59 && mm >= 0) {
+    buf[len++] = dec2bcd(mm) & 0x7F;            // 01111111
+  } else {
+    return false;
+  }
+  if(encodeAlarmHour(hh, tf, md, &buf[len++]) == false) {
+    return false;
+  }
+  if(dy == true) {
+    buf[len++] = dec2bcd(dyDt) & 0x7F | 0x40;   // 01111111 | 01000000
+  } else {
+    buf[len++] = dec2bcd(dyDt) & 0x3F;          // 00111111
+  }
+
+  return writeRegisters(regaddress, buf, len);
+};
+
+/**
+  Set Alarm from the register values of a specification
+**/
+boolean Himadri_DS3231::setAlarm(const Himadri_DS3231_AlarmSpec& spec) {
+  DS3231_STATS_API(DS3231_API_SET_ALARM);
+
+  if(spec.isValid() == false) {
+    return false;
+  }
+
+  if(spec.alarm == Alarm1) {
+    return writeRegisters(DS3231_AL1SEC_REG, spec.reg, spec.len);
+  }
+  return writeRegisters(DS3231_AL2MIN_REG, spec.reg, spec.len);
+};
+
+/**
+  Set Alarm1 matching date, hour, minutes and seconds of a Unix epoch time
+**/
+boolean Himadri_DS3231::setAlarmEpoch(uint32_t epoch, uint8_t timeFormat) {
+  DS3231_STATS_API(DS3231_API_SET_ALARM_EPOCH);
+  uint8_t buf[7];
+
+  if(epoch > DS3231_EPOCH_MAX) {
+    return false;
+  }
+  encodeEpoch(epoch / 86400UL, epoch % 86400UL, timeFormat, buf);
+
+  // A1M1 - A1M4 = 0 and DY/DT = 0, match date, hours, minutes and seconds
+  buf[3] = buf[4] & 0x3F;                   // 00111111
+
+  return writeRegisters(DS3231_AL1SEC_REG, buf, 4);
 };
 
 /**
   Enable Alarm
 **/
-void Himadri_DS3231::enableAlarm(uint8_t alarm) {
+boolean Himadri_DS3231::enableAlarm(uint8_t alarm) {
+  DS3231_STATS_API(DS3231_API_ENABLE_ALARM);
   uint8_t ctReg=0;
-  // Read control register
-  ctReg = readRegister(DS3231_CONTROL_REG);
+  // Control register from the shadow copy
+  ctReg = controlShadow();
 
   switch(alarm)
   {
       case Alarm1:
         ctReg |= 0x05;                              // 00000101
-        writeRegister(DS3231_CONTROL_REG, ctReg);   //CONTROL Register Address
-      break;
+        return writeControl(ctReg);                 //CONTROL Register Address
       case Alarm2:
         ctReg |= 0x06;                              // 00000110
-        writeRegister(DS3231_CONTROL_REG, ctReg);   //CONTROL Register Address
-      break;
+        return writeControl(ctReg);                 //CONTROL Register Address
       case BothAlarm:
         ctReg |= 0x07;                              // 00000111;
-        writeRegister(DS3231_CONTROL_REG, ctReg);   //CONTROL Register Address
-      break;
+        return writeControl(ctReg);                 //CONTROL Register Address
   }
+  return false;
 };
 
 /**
   Disable Alarm
 */
-void Himadri_DS3231::disableAlarm(uint8_t alarm) {
+boolean Himadri_DS3231::disableAlarm(uint8_t alarm) {
+  DS3231_STATS_API(DS3231_API_DISABLE_ALARM);
   uint8_t ctReg=0;
-  // Read control register
-  ctReg = readRegister(DS3231_CONTROL_REG);
+  // Control register from the shadow copy
+  ctReg = controlShadow();
 
   switch(alarm)
   {
       case Alarm1:
         ctReg &= 0xFE;                              // 11111110
-        writeRegister(DS3231_CONTROL_REG, ctReg);   //CONTROL Register Address
-      break;
+        return writeControl(ctReg);                 //CONTROL Register Address
       case Alarm2:
         ctReg &= 0xFD;                              // 11111101
-        writeRegister(DS3231_CONTROL_REG, ctReg);   //CONTROL Register Address
-      break;
+        return writeControl(ctReg);                 //CONTROL Register Address
       case BothAlarm:
         ctReg &= 0xFC;                              // 11111100;
-        writeRegister(DS3231_CONTROL_REG, ctReg);   //CONTROL Register Address
-      break;
+        return writeControl(ctReg);                 //CONTROL Register Address
   }
+  return false;
 };
 
 /**
   Get Alarm status
 **/
-boolean Himadri_DS3231::alarmStatus(uint8_t alarm) {
-  uint8_t ctReg=0;
-  // Read control register
-  ctReg = readRegister(DS3231_CONTROL_REG);
+boolean Himadri_DS3231::alarmStatus(uint8_t alarm, boolean cached) {
+  DS3231_STATS_API(DS3231_API_ALARM_STATUS);
+  uint8_t ctReg = controlRegValue(cached);
 
   if(alarm == Alarm1) {
     if((ctReg & 0x01) == 1) {                 // 00000001
@@ -1485,94 +1668,23 @@ boolean Himadri_DS3231::alarmStatus(uint8_t alarm) {
   Get Alarm time
 **/
 boolean Himadri_DS3231::readAlarmTime(struct alarmParameters* alarmVals, uint8_t alarm) {
-  Wire.beginTransmission(DS3231_ADDRESS);
+  DS3231_STATS_API(DS3231_API_READ_ALARM_TIME);
+  uint8_t buf[4];
 
   switch(alarm) {
     case Alarm1:
-      #if (ARDUINO >= 100)
-        Wire.write(DS3231_AL1SEC_REG);
-      #else
-        Wire.send(DS3231_AL1SEC_REG);
-      #endif
-      Wire.endTransmission();
-
-      Wire.requestFrom(DS3231_ADDRESS, 4, true);
-
-      #if (ARDUINO >= 100)
-        alarmVals->ss = bcd2dec(Wire.read() & 0x7F);                // 01111111
-        alarmVals->mm = bcd2dec(Wire.read() & 0x7F);                // 01111111
-        alarmVals->hh = Wire.read();
-        alarmVals->dayDate = Wire.read();
-      #else
-        alarmVals->ss = bcd2dec(Wire.receive() & 0x7F);                // 01111111
-        alarmVals->mm = bcd2dec(Wire.receive() & 0x7F);                // 01111111
-        alarmVals->hh = Wire.receive();
-        alarmVals->dayDate = Wire.receive();
-      #endif
-
-      if((alarmVals->hh & 0x40) >> 6 == 1) {                      // 01000000
-        alarmVals->tf = 1;
-        if((alarmVals->hh & 0x20) >> 5 == 1) {
-          alarmVals->md = 1;
-        } else {
-          alarmVals->md = 0;
-        }
-        alarmVals->hh = bcd2dec(alarmVals->hh & 0x1F);              // 00011111
-      } else {
-        alarmVals->tf = 0;
-        alarmVals->md =3;
-        alarmVals->hh = bcd2dec(alarmVals->hh & 0x3F);             // 00111111
-      }
-
-      if((alarmVals->dayDate & 0x40) >> 6 == 1) {                 // 01000000
-        alarmVals->dyDt = 1;
-      } else {
-        alarmVals->dyDt = 0;
+      if(readRegisters(DS3231_AL1SEC_REG, buf, 4) == false) {
+        return false;
       }
-      alarmVals->dayDate = bcd2dec(alarmVals->dayDate & 0x3F);    // 00111111
+      alarmVals->ss = bcd2dec(buf[0] & 0x7F);                      // 01111111
+      decodeAlarm(buf + 1, alarmVals);
     break;
     case Alarm2:
-      #if (ARDUINO >= 100)
-        Wire.write(DS3231_AL2MIN_REG);
-      #else
-        Wire.send(DS3231_AL2MIN_REG);
-      #endif
-      Wire.endTransmission();
-
-      Wire.requestFrom(DS3231_ADDRESS, 3, true);
-
-      alarmVals->ss = 0;
-
-      #if (ARDUINO >= 100)
-        alarmVals->mm = bcd2dec(Wire.read() & 0x7F);                  // 01111111
-        alarmVals->hh = Wire.read();
-        alarmVals->dayDate = Wire.read();
-      #else
-        alarmVals->mm = bcd2dec(Wire.receive() & 0x7F);                  // 01111111
-        alarmVals->hh = Wire.receive();
-        alarmVals->dayDate = Wire.receive();
-      #endif
-
-      if((alarmVals->hh & 0x40) >> 6 == 1) {                        // 01000000
-        alarmVals->tf = 1;
-        if((alarmVals->hh & 0x20) >> 5 == 1) {
-          alarmVals->md = 1;
-        } else {
-          alarmVals->md = 0;
-        }
-        alarmVals->hh = bcd2dec(alarmVals->hh & 0x1F);              // 00011111
-      } else {
-        alarmVals->tf = 0;
-        alarmVals->md =3;
-        alarmVals->hh = bcd2dec(alarmVals->hh & 0x3F);              // 00111111
-      }
-
-      if((alarmVals->dayDate & 0x40) >> 6 == 1) {                   // 01000000
-        alarmVals->dyDt = 1;
-      } else {
-        alarmVals->dyDt = 0;
+      if(readRegisters(DS3231_AL2MIN_REG, buf, 3) == false) {
+        return false;
       }
-      alarmVals->dayDate = bcd2dec(alarmVals->dayDate & 0x3F);    // 00111111
+      alarmVals->ss = 0;
+      decodeAlarm(buf, alarmVals);
     break;
     default:
       return false;
@@ -1584,33 +1696,15 @@ boolean Himadri_DS3231::readAlarmTime(struct alarmParameters* alarmVals, uint8_t
 /**
   Get Temperature
 */
-float Himadri_DS3231::readTemp(uint8_t scale = Celsius) {
+float Himadri_DS3231::readTemp(uint8_t scale) {
+  DS3231_STATS_API(DS3231_API_READ_TEMP);
   float rv;
-  uint8_t tempMsb, tempLsb;
-  int8_t nint;
-
-  Wire.beginTransmission(DS3231_ADDRESS);
-  Wire.write(DS3231_TEMPERATURE_MSG_REG);
-  Wire.endTransmission();
-
-  Wire.requestFrom(DS3231_ADDRESS, 2);
+  uint8_t buf[2];
 
-  #if (ARDUINO >= 100)
-    tempMsb = Wire.read();
-    tempLsb = Wire.read() >> 6;
-  #else
-    tempMsb = Wire.receive();
-    tempLsb = Wire.receive() >> 6;
-  #endif
-
-  if ((tempMsb & 0x80) != 0) {               // 10000000
-    tempMsb ^= 0xFF;                         // 11111111
-    tempMsb  += 0x1;                         // 00000001
-    rv = tempMsb + (tempLsb * 0.25);
-    rv = rv * -1;
-  } else {
-      rv = tempMsb + (tempLsb * 0.25);
+  if(readRegisters(DS3231_TEMPERATURE_MSG_REG, buf, 2) == false) {
+    return NAN;
   }
+  rv = decodeTemp(buf[0], buf[1]);
 
   switch(scale) {
     case Celsius:
@@ -1626,31 +1720,184 @@ float Himadri_DS3231::readTemp(uint8_t scale = Celsius) {
   return rv;
 };
 
+/**
+  Get Temperature in 0.25 degree Celsius steps
+**/
+boolean Himadri_DS3231::readTempRaw(int16_t* quarterDegrees) {
+  DS3231_STATS_API(DS3231_API_READ_TEMP_RAW);
+  uint8_t buf[2];
+
+  if(readRegisters(DS3231_TEMPERATURE_MSG_REG, buf, 2) == false) {
+    return false;
+  }
+  *quarterDegrees = decodeTempRaw(buf[0], buf[1]);
+
+  return true;
+};
+
+/**
+  Get Temperature in 0.01 degree steps of Celsius / Fahrenheit / Kelvin
+**/
+boolean Himadri_DS3231::readTempCentiDegrees(int32_t* centiDegrees, uint8_t scale) {
+  DS3231_STATS_API(DS3231_API_READ_TEMP_CENTI);
+  int16_t raw;
+
+  if(readTempRaw(&raw) == false) {
+    return false;
+  }
+
+  switch(scale) {
+    case Celsius:
+      *centiDegrees = (int32_t)raw * 25;
+    break;
+    case Fahrenheit:
+      // 0.25 * 1.8 = 0.45 degree Fahrenheit per step
+      *centiDegrees = (int32_t)raw * 45 + 3200;
+    break;
+    case Kelvin:
+      *centiDegrees = (int32_t)raw * 25 + 27315;
+    break;
+    default:
+      return false;
+    break;
+  }
+
+  return true;
+};
+
 /**
   Force activate Temperature convertion by the chip
 **/
 boolean Himadri_DS3231::convertTemp() {
-  uint8_t ctReg=0;
-  // Read control register
-  ctReg = readRegister(DS3231_CONTROL_REG);
+  DS3231_STATS_API(DS3231_API_CONVERT_TEMP);
+  unsigned long start = millis();
 
-  ctReg |= 0x20;                              // 00100000
-  writeRegister(DS3231_CONTROL_REG, ctReg);   //CONTROL Register Address
+  // Wait for a conversion started by the chip itself, BSY set
+  while(startConvertTemp() == false) {
+    if((statusRegShadow & 0x04) == 0 || millis() - start >= convTimeout) {     // 00000100
+      return false;
+    }
+    delay(convInterval);
+  }
 
   //wait until CONV is cleared. Indicates new temperature value is available in register.
   do
   {
-     //do nothing
-  } while ((readRegister(DS3231_CONTROL_REG) & 0x20) >> 5 == 1);    // 00100000
+    delay(convInterval);
+  } while (pollConvertTemp() == ConvBusy);
+
+  return tempReady();
+};
+
+/**
+  Start a temperature conversion by writing CONV and return without waiting
+**/
+boolean Himadri_DS3231::startConvertTemp() {
+  DS3231_STATS_API(DS3231_API_START_CONVERT_TEMP);
+  uint8_t ctReg=0;
+  uint8_t statusReg;
+
+  if(readRegisters(DS3231_STATUS_REG, &statusReg, 1) == false) {
+    shadowValid = false;
+    return false;
+  }
+  statusRegShadow = statusReg;
+  if((statusReg & 0x04) != 0) {               // 00000100
+    return false;
+  }
+
+  // Control register from the shadow copy
+  ctReg = controlShadow();
+
+  ctReg |= 0x20;                              // 00100000
+  if(writeControl(ctReg) == false) {          //CONTROL Register Address
+    return false;
+  }
 
+  convState = ConvBusy;
+  convStartMs = millis();
+  convPollMs = convStartMs;
   return true;
 };
 
+/**
+  Check the conversion started by startConvertTemp
+**/
+uint8_t Himadri_DS3231::pollConvertTemp() {
+  DS3231_STATS_API(DS3231_API_POLL_CONVERT_TEMP);
+  if(convState != ConvBusy) {
+    return convState;
+  }
+
+  unsigned long now = millis();
+  if(now - convPollMs < convInterval) {
+    return convState;
+  }
+  convPollMs = now;
+
+  uint8_t ctReg;
+  if(readRegisters(DS3231_CONTROL_REG, &ctReg, 1) == false) {
+    // A failed read is not a busy chip, the shadow copy is read again on the next change
+    shadowValid = false;
+    convState = ConvError;
+  } else if((ctReg & 0x20) >> 5 == 0) {                // 00100000
+    ctRegShadow = ctReg;
+    convState = ConvReady;
+  } else if(now - convStartMs >= convTimeout) {
+    convState = ConvTimeout;
+  } else {
+    return convState;
+  }
+
+  if(convCallback != NULL) {
+    convCallback(convState);
+  }
+  return convState;
+};
+
+/**
+  Get whether the last conversion finished
+**/
+boolean Himadri_DS3231::tempReady() {
+  if(convState == ConvReady) {
+    return true;
+  } else {
+    return false;
+  }
+};
+
+/**
+  Set the cadence and the time limit of the conversion polling
+**/
+void Himadri_DS3231::setConvertTempTiming(uint16_t interval, uint16_t timeout) {
+  convInterval = interval;
+  convTimeout = timeout;
+};
+
+/**
+  Set the function called when the conversion becomes ready or times out
+**/
+void Himadri_DS3231::onConvertTemp(void (*callback)(uint8_t state)) {
+  convCallback = callback;
+};
+
 /**
   Get Control Register value
 **/
-uint8_t Himadri_DS3231::controlRegValue() {
-  uint8_t ctReg = readRegister(DS3231_CONTROL_REG);
+uint8_t Himadri_DS3231::controlRegValue(boolean cached) {
+  DS3231_STATS_API(DS3231_API_CONTROL_REG_VALUE);
+  if(cached == true) {
+    controlShadow();
+    return ctRegShadow;
+  }
+
+  uint8_t ctReg = 0xFF;
+  if(readRegisters(DS3231_CONTROL_REG, &ctReg, 1) == false) {
+    // The shadow copy is kept, the next change reads the register again
+    shadowValid = false;
+    return 0xFF;
+  }
+  ctRegShadow = ctReg;
 
   return ctReg;
 };
@@ -1659,14 +1906,15 @@ uint8_t Himadri_DS3231::controlRegValue() {
   Enable EOSC register which enables the oscillator
 **/
 boolean Himadri_DS3231::enableDisableOscillator(uint8_t choice) {
-  uint8_t ctReg = readRegister(DS3231_CONTROL_REG);
+  DS3231_STATS_API(DS3231_API_OSCILLATOR);
+  uint8_t ctReg = controlShadow();
 
   if(choice == 1) {
     ctReg &= 0x7F;          // 01111111
-    writeRegister(DS3231_CONTROL_REG, ctReg);
+    return writeControl(ctReg);
   } else if(choice == 2) {
     ctReg |= 0x80;          // 10000000
-    writeRegister(DS3231_CONTROL_REG, ctReg);
+    return writeControl(ctReg);
   } else {
     return false;
   }
@@ -1678,8 +1926,9 @@ boolean Himadri_DS3231::enableDisableOscillator(uint8_t choice) {
   Get EOSC bit on Control Register with 0 for start
   and 1 for stop when the device switches to VBAT
 */
-boolean Himadri_DS3231::oscillatorStatus() {
-  uint8_t ctReg = readRegister(DS3231_CONTROL_REG);
+boolean Himadri_DS3231::oscillatorStatus(boolean cached) {
+  DS3231_STATS_API(DS3231_API_OSCILLATOR_STATUS);
+  uint8_t ctReg = controlRegValue(cached);
 
   if((ctReg & 0x80) >> 7 == 1) {    // 10000000
     return true;
@@ -1694,17 +1943,20 @@ boolean Himadri_DS3231::oscillatorStatus() {
   1Hz square wave
 **/
 boolean Himadri_DS3231::enableDisableBBSQW(uint8_t choice) {
-  uint8_t ctReg = readRegister(DS3231_CONTROL_REG);
+  DS3231_STATS_API(DS3231_API_BBSQW);
+  uint8_t ctReg = controlShadow();
 
   if(choice == 1) {
-    ctReg &= 0x40 | 0xFB;          // 01000000  11111011
-    writeRegister(DS3231_CONTROL_REG, ctReg);
+    ctReg = (ctReg | 0x40) & 0xFB;  // 01000000  11111011
+    return writeControl(ctReg);
   } else if(choice == 2) {
-    ctReg &= 0xBF | 0x04;          // 01111111  00000100
-    writeRegister(DS3231_CONTROL_REG, ctReg);
+    ctReg &= 0xBF;                  // 10111111
+    return writeControl(ctReg);
   } else {
     return false;
   }
+
+  return true;
 };
 
 /**
@@ -1712,8 +1964,9 @@ boolean Himadri_DS3231::enableDisableBBSQW(uint8_t choice) {
   and 0 for stop with INTCN = 0 and VCC < VPF, enabling this generates
   1Hz square wave
 **/
-boolean Himadri_DS3231::bbsqwStatus() {
-  uint8_t ctReg = readRegister(DS3231_CONTROL_REG);
+boolean Himadri_DS3231::bbsqwStatus(boolean cached) {
+  DS3231_STATS_API(DS3231_API_BBSQW_STATUS);
+  uint8_t ctReg = controlRegValue(cached);
 
   if((ctReg & 0x44) == 64) {    // 01000100
     return true;
@@ -1725,8 +1978,9 @@ boolean Himadri_DS3231::bbsqwStatus() {
 /**
   Get INTCN bit on Control Register with 1 for enable and 0 for disable
 **/
-boolean Himadri_DS3231::intcnStatus() {
-  uint8_t ctReg = readRegister(DS3231_CONTROL_REG);
+boolean Himadri_DS3231::intcnStatus(boolean cached) {
+  DS3231_STATS_API(DS3231_API_INTCN_STATUS);
+  uint8_t ctReg = controlRegValue(cached);
 
   if((ctReg & 0x04) >> 2 == 1) {    // 00000100
     return true;
@@ -1735,11 +1989,47 @@ boolean Himadri_DS3231::intcnStatus() {
   }
 };
 
+/**
+  Set RS2 and RS1 bits on Control Register and clear INTCN
+**/
+boolean Himadri_DS3231::setSQWFrequency(uint8_t freq) {
+  DS3231_STATS_API(DS3231_API_SET_SQW_FREQUENCY);
+  if(freq < SQW1Hz || freq > SQW8192Hz) {
+    return false;
+  }
+
+  uint8_t ctReg = controlShadow();
+  ctReg &= 0xE3;                            // 11100011
+  ctReg |= (freq - 1) << 3;                 // 000RR000
+  return writeControl(ctReg);
+};
+
+/**
+  Get RS2 and RS1 bits on Control Register
+**/
+uint8_t Himadri_DS3231::sqwFrequency(boolean cached) {
+  DS3231_STATS_API(DS3231_API_SQW_FREQUENCY);
+  uint8_t ctReg = controlRegValue(cached);
+
+  return ((ctReg & 0x18) >> 3) + 1;         // 00011000
+};
+
 /**
   Get Status Register value
 **/
-uint8_t Himadri_DS3231::statusRegValue() {
-  uint8_t statusReg = readRegister(DS3231_STATUS_REG);
+uint8_t Himadri_DS3231::statusRegValue(boolean cached) {
+  DS3231_STATS_API(DS3231_API_STATUS_REG_VALUE);
+  if(cached == true) {
+    return statusShadow();
+  }
+
+  uint8_t statusReg = 0xFF;
+  if(readRegisters(DS3231_STATUS_REG, &statusReg, 1) == false) {
+    // The shadow copy is kept, the next change reads the register again
+    shadowValid = false;
+    return 0xFF;
+  }
+  statusRegShadow = statusReg;
 
   return statusReg;
 };
@@ -1748,8 +2038,9 @@ uint8_t Himadri_DS3231::statusRegValue() {
   Get OSF (Oscillator stop flag) bit on Status Register with 1 for stop
   and 0 for start
 */
-boolean Himadri_DS3231::osfStatus() {
-  uint8_t statusReg = readRegister(DS3231_STATUS_REG);
+boolean Himadri_DS3231::osfStatus(boolean cached) {
+  DS3231_STATS_API(DS3231_API_OSF_STATUS);
+  uint8_t statusReg = statusRegValue(cached);
 
   if((statusReg & 0x80) >> 7 == 1) {
     return true;
@@ -1763,23 +2054,27 @@ boolean Himadri_DS3231::osfStatus() {
   It Enable / Disable 32.768Khz Square Wave output
 **/
 boolean Himadri_DS3231::enableDisable32Khz(uint8_t choice) {
-  uint8_t statusReg = readRegister(DS3231_STATUS_REG);
+  DS3231_STATS_API(DS3231_API_EN32KHZ);
+  uint8_t statusReg = statusShadow();
   if(choice == 1) {
     statusReg |= 0x08;                  // 00001000
-    writeRegister(DS3231_STATUS_REG, statusReg);
+    return writeStatus(statusReg);
   } else if(choice == 2) {
     statusReg &= 0xF7;                  // 11110111
-    writeRegister(DS3231_STATUS_REG, statusReg);
+    return writeStatus(statusReg);
   } else {
     return false;
   }
+
+  return true;
 };
 
 /**
   Get EN32KHZ bit on Status Register with 1 for start and 0 for stop
 **/
-boolean Himadri_DS3231::en32KhzStatus() {
-  uint8_t statusReg = readRegister(DS3231_STATUS_REG);
+boolean Himadri_DS3231::en32KhzStatus(boolean cached) {
+  DS3231_STATS_API(DS3231_API_EN32KHZ_STATUS);
+  uint8_t statusReg = statusRegValue(cached);
 
   if((statusReg & 0x08) >> 3 == 1) {        // 00001000
     return true;
@@ -1791,8 +2086,9 @@ boolean Himadri_DS3231::en32KhzStatus() {
 /**
   Get Temperature Busy Status
 */
-boolean Himadri_DS3231::bsyStatus() {
-  uint8_t statusReg = readRegister(DS3231_STATUS_REG);
+boolean Himadri_DS3231::bsyStatus(boolean cached) {
+  DS3231_STATS_API(DS3231_API_BSY_STATUS);
+  uint8_t statusReg = statusRegValue(cached);
 
   if((statusReg & 0x04) >> 2 == 1) {      // 00000100
     return true;
@@ -1805,6 +2101,7 @@ boolean Himadri_DS3231::bsyStatus() {
   Get Aging Register value
 **/
 uint8_t Himadri_DS3231::agingRegValue() {
+  DS3231_STATS_API(DS3231_API_AGING_REG_VALUE);
   uint8_t agingReg = readRegister(DS3231_AGING_REG);
 
   if ((agingReg & 0x80) != 0) {                 // 10000000
@@ -1822,11 +2119,12 @@ uint8_t Himadri_DS3231::agingRegValue() {
   time base
 **/
 boolean Himadri_DS3231::setAgingRegValue(int8_t val) {
+  DS3231_STATS_API(DS3231_API_SET_AGING_REG_VALUE);
   if(val <= 127 && val >= 0) {
-    writeRegister(DS3231_AGING_REG, val);
+    return writeRegister(DS3231_AGING_REG, val);
   } else if(val < 0 && val >= -127) {
     val = ~(-val) + 1;      // 2's complement
-    writeRegister(DS3231_AGING_REG, val);
+    return writeRegister(DS3231_AGING_REG, val);
   } else {
     return false;
   }
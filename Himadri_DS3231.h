@@ -49,6 +49,29 @@ This library implements the following features:
   29. Get BSY status
   30. Get Aging Register value
   31. Set Aging Register value
+  32. Read all registers in a single transaction as a snapshot
+  33. Control / Status Register shadow copy for single write bit updates and cached getters
+  34. Non-blocking temperature conversion with poll cadence, timeout and callback
+  35. Read / Set Date and Time as Unix epoch seconds (32 and 64 bit)
+  36. Millisecond software clock extrapolated with millis() and periodic resync (Himadri_DS3231_Clock)
+  37. Select 1Hz / 1.024kHz / 4.096kHz / 8.192kHz square wave and count its ticks in an interrupt (Himadri_DS3231_SQW)
+  38. Microsecond timestamps from the 1Hz square wave edge without I2C traffic per event
+  39. Software alarm scheduler multiplexing many jobs onto Alarm1 (Himadri_DS3231_Scheduler)
+  40. Register level transport interface so the driver runs over TwoWire, other buses or the simulator (Himadri_DS3231_Transport)
+  41. Linux i2c-dev transport with the register address write and burst read in one I2C_RDWR repeated START transaction (Himadri_DS3231_LinuxTransport)
+  42. Optional bus counters and per API latency histograms, compiled out unless HIMADRI_DS3231_STATS is defined (Himadri_DS3231_Stats)
+  43. Host benchmark of bus transactions, bytes and ns/op per API with a baseline that fails the run on regressions (extras/benchmark)
+  44. Integer temperature in 0.25 degree steps or hundredths of Celsius / Fahrenheit / Kelvin without floating point
+  45. BCD registers decoded in one pass with a 256 byte flash table and encoded without a division, HIMADRI_DS3231_BCD_ARITHMETIC selects the arithmetic conversion
+  46. Alarm register values computed at compile time from constexpr specifications and written in one transaction (Himadri_DS3231_AlarmSpec)
+  47. Set Date and Time in one transaction after validating every field, leaving the clock and the structure untouched on error
+  48. Set Date and Time on the second boundary of a reference time with a sub-second phase, reporting the write latency
+  49. Alarm interrupt dispatcher with a lock-free ring filled by the interrupt handler and a loop() pump reading and clearing A1F / A2F in one write (Himadri_DS3231_Events)
+  50. Deep-sleep wake planner programming the next wake into Alarm1 with one burst write and moving the software clock to the wake edge after one read (Himadri_DS3231_Sleep)
+  51. Boot configuration probing the chip and writing Control and Status Register in one transaction, returning a status code without Serial output
+  52. Instances on any TwoWire bus and address, so chips on separate I2C controllers are driven independently
+  53. TCA9548A multiplexer device handles skipping redundant channel selects and a poll reading N chips with one select per channel (Himadri_DS3231_Mux)
+  54. Fluent setter transaction validating the changed fields together and writing each run of consecutive registers in one burst (Himadri_DS3231_Transaction)
 
 ******************************/
 
@@ -68,6 +91,9 @@ This library implements the following features:
   #endif
 
   #include <Wire.h>
+  #include "Himadri_DS3231_Transport.h"
+  #include "Himadri_DS3231_WireTransport.h"
+  #include "Himadri_DS3231_Stats.h"
 
   /******************************
            DS3231 RTC
@@ -96,6 +122,25 @@ This library implements the following features:
     Status Register Address
   -------------------------------*/
 
+  /*-------------------------------
+    Default Boot Configuration
+  -------------------------------*/
+  #define DS3231_CONFIG_CONTROL       0x1C    // 00011100 INTCN, RS2, RS1, alarm interrupts off
+  #define DS3231_CONFIG_EN32KHZ       true
+  /*-------------------------------
+    Default Boot Configuration
+  -------------------------------*/
+
+  /*-------------------------------
+        Begin Status Codes
+  -------------------------------*/
+  #define DS3231_BEGIN_OK             0x00    // Probed and configured
+  #define DS3231_BEGIN_PROBE          0x10    // Probe failed, the low nibble is the bus status
+  #define DS3231_BEGIN_CONFIG         0x20    // Configuration write failed, the low nibble is the bus status
+  /*-------------------------------
+        Begin Status Codes
+  -------------------------------*/
+
   /*-------------------------------
       Aging Register Address
   -------------------------------*/
@@ -134,6 +179,14 @@ This library implements the following features:
         Timekeeping Register
   -------------------------------*/
 
+  /*-------------------------------
+      Number Of Registers 0x00 - 0x12
+  -------------------------------*/
+  #define DS3231_REGISTER_COUNT       0x13
+  /*-------------------------------
+      Number Of Registers 0x00 - 0x12
+  -------------------------------*/
+
   /*-------------------------------
         Timeformat Choice
   -------------------------------*/
@@ -163,6 +216,17 @@ This library implements the following features:
         Interrupt Choice
   -------------------------------*/
 
+  /*-------------------------------
+    Square Wave Frequency Choice
+  -------------------------------*/
+  #define SQW1Hz                     0x01
+  #define SQW1024Hz                  0x02
+  #define SQW4096Hz                  0x03
+  #define SQW8192Hz                  0x04
+  /*-------------------------------
+    Square Wave Frequency Choice
+  -------------------------------*/
+
   /*-------------------------------
       Temperature Scale Choice
   -------------------------------*/
@@ -182,6 +246,49 @@ This library implements the following features:
       Enable / Disable Choice
   -------------------------------*/
 
+  /*-------------------------------
+    Temperature Conversion State
+  -------------------------------*/
+  #define ConvIdle                    0x00
+  #define ConvBusy                    0x01
+  #define ConvReady                   0x02
+  #define ConvTimeout                 0x03
+  #define ConvError                   0x04    // Control Register could not be read
+  /*-------------------------------
+    Temperature Conversion State
+  -------------------------------*/
+
+  /*-------------------------------
+    Temperature Conversion Timing
+          In Milliseconds
+  -------------------------------*/
+  #define DS3231_CONV_POLL_MS         10
+  #define DS3231_CONV_TIMEOUT_MS      250
+  /*-------------------------------
+    Temperature Conversion Timing
+          In Milliseconds
+  -------------------------------*/
+
+  /*-------------------------------
+      Unix Epoch Range Of DS3231
+  -------------------------------*/
+  #define DS3231_EPOCH_MAX            4102444799UL      // 2099/12/31 23:59:59
+  #define DS3231_EPOCH64_MIN          -2208988800LL     // 1900/01/01 00:00:00
+  /*-------------------------------
+      Unix Epoch Range Of DS3231
+  -------------------------------*/
+
+  /*-------------------------------
+      BCD Conversion Switch
+    BCD registers are decoded with
+    a 256 byte table in flash,
+    define it to use arithmetic
+  -------------------------------*/
+  // #define HIMADRI_DS3231_BCD_ARITHMETIC
+  /*-------------------------------
+      BCD Conversion Switch
+  -------------------------------*/
+
   /*-------------------------------
           Days Of Month
         Storing It In SRAM
@@ -222,11 +329,62 @@ This library implements the following features:
     uint8_t dyDt;           // 0 -> Date of the month / 1 -> Day of the week
   };
 
+  /*-------------------------------
+        Register Snapshot
+      Structure Declaration
+  -------------------------------*/
+  struct snapshotParameters {
+    struct timeParameters time;       // current date and time
+    struct alarmParameters alarm1;    // Alarm1 configured time
+    struct alarmParameters alarm2;    // Alarm2 configured time
+    uint8_t control;                  // Control Register value
+    uint8_t status;                   // Status Register value
+    int8_t aging;                     // Aging Register value
+    float temp;                       // temperature in Celsius
+  };
+
+  /*-------------------------------
+      Aligned Time Setting Report
+      Structure Declaration
+  -------------------------------*/
+  struct syncParameters {
+    unsigned long leadMicros;         // write started this long before the second boundary
+    unsigned long writeMicros;        // measured duration of the burst write
+    long errorMicros;                 // estimated Seconds Register write minus the second boundary
+  };
+
+  /*-------------------------------
+      Boot Configuration
+      Structure Declaration
+  -------------------------------*/
+  struct configParameters {
+    uint8_t control;                  // Control Register value, CONV is never written
+    boolean en32kHz;                  // EN32kHz bit of the Status Register
+  };
+
+  class Himadri_DS3231_AlarmSpec;
+  class Himadri_DS3231_Transaction;
+
   class Himadri_DS3231 {
     /*-------------------------------
       Private Function Declaration
     -------------------------------*/
     private:
+      Himadri_DS3231_Transport* bus;          // transport carrying every register access, NULL on a TwoWire bus
+      TwoWire* wire;                          // TwoWire bus used when there is no transport
+      uint8_t deviceAddress;                  // I2C slave address on the TwoWire bus
+
+      uint8_t ctRegShadow;        // shadow copy of the Control Register
+      uint8_t statusRegShadow;    // shadow copy of the Status Register
+      boolean shadowValid;        // true when the shadow copies match the chip
+
+      uint8_t convState;                  // temperature conversion state
+      unsigned long convStartMs;          // millis() when the conversion was started
+      unsigned long convPollMs;           // millis() of the last CONV poll
+      uint16_t convInterval;              // milliseconds between CONV polls
+      uint16_t convTimeout;               // milliseconds before the conversion times out
+      void (*convCallback)(uint8_t state);
+
       /**
         Returns Decimal to BCD
 
@@ -243,6 +401,17 @@ This library implements the following features:
       */
       static uint8_t bcd2dec(uint8_t value);
 
+      /**
+        Decode consecutive BCD registers to Decimal in one pass
+
+        @param buf Register values in BCD
+        @param masks Mask of the BCD bits of every register
+        @param values Receives the values in Decimal
+        @param len Number of registers
+        @return Return void
+      */
+      static void bcd2decBlock(const uint8_t* buf, const uint8_t* masks, uint8_t* values, uint8_t len);
+
       /**
         Returns 2 digit decimal from String
 
@@ -282,21 +451,243 @@ This library implements the following features:
 
         @param regaddress The address of the register to write
         @param value 8 bit unsigned integer value to write to register
-        @return Return 8 bit unsigned integer from the register address
+        @return Return boolean
       */
-      void writeRegister(uint8_t regaddress, uint8_t value);
+      boolean writeRegister(uint8_t regaddress, uint8_t value);
+
+      /**
+        Reads consecutive registers in a single transaction
+
+        @param regaddress The address of the first register to read
+        @param buf Buffer receiving the register values
+        @param len Number of registers to read
+        @return Return boolean
+      */
+      boolean readRegisters(uint8_t regaddress, uint8_t* buf, uint8_t len);
+
+      /**
+        Writes consecutive registers in a single transaction
+
+        @param regaddress The address of the first register to write
+        @param buf Register values to write
+        @param len Number of registers to write
+        @return Return boolean
+      */
+      boolean writeRegisters(uint8_t regaddress, const uint8_t* buf, uint8_t len);
+
+      /**
+        Initialize the bus and address the device without data
+
+        @return Return DS3231_BUS_OK or the transport status code
+      */
+      uint8_t probeBus(void);
+
+      /**
+        Writes consecutive registers through the transport or the TwoWire bus
+
+        @param regaddress The address of the first register to write
+        @param buf Register values to write
+        @param len Number of registers to write
+        @return Return DS3231_BUS_OK or the transport status code
+      */
+      uint8_t writeBus(uint8_t regaddress, const uint8_t* buf, uint8_t len);
+
+      /**
+        Returns the number of days since 1970/01/01 of a civil date
+
+        @param year Unsigned integer value for Year
+        @param month Unsigned integer value for Month
+        @param date Unsigned integer value for Date
+        @return Return days, negative before 1970
+      */
+      static int32_t daysFromCivil(uint16_t year, uint8_t month, uint8_t date);
+
+      /**
+        Decode the 7 timekeeping registers to days since 1970/01/01 and
+        seconds of the day
+
+        @param buf Register values starting from the Seconds Register
+        @param days Days since 1970/01/01, negative before 1970
+        @param secs Seconds since midnight
+        @return Return void
+      */
+      static void decodeEpoch(const uint8_t* buf, int32_t* days, uint32_t* secs);
+
+      /**
+        Encode days since 1970/01/01 and seconds of the day into the 7
+        timekeeping registers
+
+        @param days Days since 1970/01/01, negative before 1970
+        @param secs Seconds since midnight
+        @param timeFormat The TwelveHrFormat / TwentyFourHrFormat option parameter
+        @param buf Register values starting from the Seconds Register
+        @return Return void
+      */
+      static void encodeEpoch(int32_t days, uint32_t secs, uint8_t timeFormat, uint8_t* buf);
+
+      /**
+        Validate every field of the Date and Time and encode it into the 7
+        timekeeping registers, the structure is not changed
+
+        @param timeVals Date and Time timeParameters structure variable
+        @param buf Register values starting from the Seconds Register
+        @return Return boolean
+      */
+      boolean encodeDateTime(const struct timeParameters* timeVals, uint8_t* buf);
+
+      /**
+        Decode the 7 timekeeping registers
+
+        @param buf Register values starting from the Seconds Register
+        @param timeVals Pointer reference of the timeParameters structure variable
+        @return Return void
+      */
+      static void decodeDateTime(const uint8_t* buf, struct timeParameters* timeVals);
+
+      /**
+        Decode the minutes, hour and day / date alarm registers
+
+        @param buf Register values starting from the Alarm Minutes Register
+        @param alarmVals Alarm time structure variable reference
+        @return Return void
+      */
+      static void decodeAlarm(const uint8_t* buf, struct alarmParameters* alarmVals);
+
+      /**
+        Decode the temperature registers
+
+        @param msb Temperature MSB Register value
+        @param lsb Temperature LSB Register value
+        @return Return the temperature in Celsius
+      */
+      static float decodeTemp(uint8_t msb, uint8_t lsb);
+
+      /**
+        Decode the temperature registers without floating point
+
+        @param msb Temperature MSB Register value
+        @param lsb Temperature LSB Register value
+        @return Return the temperature in 0.25 degree Celsius steps
+      */
+      static int16_t decodeTempRaw(uint8_t msb, uint8_t lsb);
+
+      /**
+        Returns the Control Register value from the shadow copy with CONV
+        cleared, reading Control and Status Register from the chip if the
+        copy is invalid
+
+        @return Return the value of Control Register
+      */
+      uint8_t controlShadow(void);
+
+      /**
+        Returns the Status Register value from the shadow copy, reading
+        Control and Status Register from the chip if the copy is invalid
+
+        @return Return the value of Status Register
+      */
+      uint8_t statusShadow(void);
+
+      /**
+        Write the Control Register and update the shadow copy. CONV is
+        only written as 1 when a conversion is requested. A failed write
+        invalidates the shadow copy.
+
+        @param value 8 bit unsigned integer value to write to register
+        @return Return boolean
+      */
+      boolean writeControl(uint8_t value);
+
+      /**
+        Write the Status Register and update the shadow copy. OSF, A2F and
+        A1F can only be cleared by the chip, they are written as 1 unless
+        the bit is cleared in clearMask. A failed write invalidates the
+        shadow copy.
+
+        @param value 8 bit unsigned integer value to write to register
+        @param clearMask Hardware flags OSF / A2F / A1F to clear
+        @return Return boolean
+      */
+      boolean writeStatus(uint8_t value, uint8_t clearMask = 0x00);
+
+      /**
+        Reset the shadow copy and the temperature conversion state
+
+        @return Return void
+      */
+      void initState(void);
+
+      /**
+        Encode the hour of an alarm register with time format and meridian
+
+        @param hh Unsigned integer value for Hour
+        @param tf The time format true for 12Hr and false for 24Hr
+        @param md The meridian true for PM and false for AM
+        @param reg Receives the register value
+        @return Return boolean
+      */
+      static boolean encodeAlarmHour(uint8_t hh, boolean tf, boolean md, uint8_t* reg);
 
     /*-------------------------------
       Public Function Declaration
     -------------------------------*/
     public:
+      /**
+        Create the driver on the Wire bus with an invalid Control / Status
+        shadow copy
+      */
+      Himadri_DS3231(void);
+
+      /**
+        Create the driver on a TwoWire bus and address with an invalid
+        Control / Status shadow copy, e.g. Wire1 of a Teensy / ESP32. Every
+        instance keeps its own bus, address and shadow copy.
+
+        @param wire The TwoWire bus the DS3231 is connected to
+        @param address The I2C slave address of the DS3231
+      */
+      Himadri_DS3231(TwoWire& wire, uint8_t address = DS3231_ADDRESS);
+
+      /**
+        Create the driver on a transport with an invalid Control / Status
+        shadow copy
+
+        @param transport The transport carrying the register accesses
+      */
+      Himadri_DS3231(Himadri_DS3231_Transport& transport);
+
+      /**
+        Read Control and Status Register in a single transaction into the
+        shadow copy
+
+        @return Return boolean
+      */
+      boolean refreshShadow(void);
+
+      /**
+        Mark the Control / Status shadow copy invalid so the next bit update
+        reads the chip again. Call it when something else writes the registers.
+
+        @return Return void
+      */
+      void invalidateShadow(void);
+
       /**
         Clear Alarm Flag in Status Register
 
         @param alarm The Alarm1 / Alarm2 / Both option parameter to clear the specified flag or both flag
-        @return Return void
+        @return Return boolean
       */
-      void clearINTStatus(uint8_t alarm);
+      boolean clearINTStatus(uint8_t alarm);
+
+      /**
+        Read the Status Register once and clear the A1F / A2F flags found
+        set in the same write, so an alarm firing in between is kept
+
+        @param alarms Receives the fired alarms, 0 / Alarm1 / Alarm2 / BothAlarm
+        @return Return boolean
+      */
+      boolean readClearAlarmStatus(uint8_t* alarms);
 
       /**
         Initialize the Timekeeping Register value with initial Date and Time of
@@ -315,6 +706,20 @@ This library implements the following features:
       */
       boolean begin(void);
 
+      /**
+        Probe the chip and write the Control and Status Register in one
+        transaction, without reading them first and without Serial output.
+        A1F and A2F are cleared, OSF is left unchanged. The shadow copy is
+        seeded from the written values, so the first bit update needs no
+        read. OSF is kept set in the copy until the next read because the
+        write does not change it.
+
+        @param config The boot configuration, NULL for DS3231_CONFIG_CONTROL and DS3231_CONFIG_EN32KHZ
+        @return Return DS3231_BEGIN_OK (0) on success, unlike begin(), or
+        DS3231_BEGIN_PROBE / DS3231_BEGIN_CONFIG with the bus status
+      */
+      uint8_t beginConfig(const struct configParameters* config);
+
       /**
         Initialize Date and Time structure variable by passing date and time as string
 
@@ -333,6 +738,17 @@ This library implements the following features:
       */
       boolean setDateTime(struct timeParameters* timeVals);
 
+      /**
+        Set Date and Time in 12 / 24 Hr format only when every field is valid.
+        All fields are validated before the bus is used and the registers are
+        written in a single transaction, on error the clock and the structure
+        variable are left untouched
+
+        @param timeVals Date and Time timeParameters structure variable
+        @return Return boolean
+      */
+      boolean setDateTimeAtomic(const struct timeParameters* timeVals);
+
       /**
         Set Seconds
 
@@ -387,11 +803,24 @@ This library implements the following features:
       /**
         Set Year
 
-        @param year Year unsigned integer value
+        @param year Year unsigned integer value 1900 - 2099
         @return Return boolean
       */
       boolean setYear(uint16_t year);
 
+      /**
+        Write the fields collected by a setter transaction, see
+        Himadri_DS3231_Transaction.h. Every field is validated first, the
+        resulting date against the resulting month and year, and nothing
+        is written on error. Each run of consecutive changed registers is
+        one burst write. Date, Month and Year are read in one transaction
+        only when some but not all of them change.
+
+        @param tx The collected fields
+        @return Return boolean
+      */
+      boolean commit(const Himadri_DS3231_Transaction& tx);
+
       /**
         Get current Date and Time
 
@@ -400,6 +829,67 @@ This library implements the following features:
       */
       boolean readDateTime(struct timeParameters* timeVals);
 
+      /**
+        Get current Date and Time as seconds since 1970/01/01 00:00:00
+
+        @param epoch Pointer reference receiving the seconds
+        @return Return boolean, false if the clock is before 1970
+      */
+      boolean readEpoch(uint32_t* epoch);
+
+      /**
+        Set Date and Time from seconds since 1970/01/01 00:00:00 up to
+        2099/12/31 23:59:59 in a single transaction
+
+        @param epoch Seconds since 1970/01/01 00:00:00
+        @param timeFormat The TwelveHrFormat / TwentyFourHrFormat option parameter
+        @return Return boolean
+      */
+      boolean setEpoch(uint32_t epoch, uint8_t timeFormat = TwentyFourHrFormat);
+
+      /**
+        Get current Date and Time as signed seconds since 1970/01/01 00:00:00,
+        negative for dates from 1900
+
+        @param epoch Pointer reference receiving the seconds
+        @return Return boolean
+      */
+      boolean readEpoch64(int64_t* epoch);
+
+      /**
+        Set Date and Time from signed seconds since 1970/01/01 00:00:00
+        covering 1900/01/01 00:00:00 till 2099/12/31 23:59:59
+
+        @param epoch Signed seconds since 1970/01/01 00:00:00
+        @param timeFormat The TwelveHrFormat / TwentyFourHrFormat option parameter
+        @return Return boolean
+      */
+      boolean setEpoch64(int64_t epoch, uint8_t timeFormat = TwentyFourHrFormat);
+
+      /**
+        Set Date and Time from a reference so the new second starts on the
+        second boundary of the reference. The burst write is started early
+        by the bus time up to the Seconds Register, which restarts the
+        countdown chain of the chip, and the next second is written
+
+        @param epoch Reference seconds since 1970/01/01 00:00:00
+        @param phase Microseconds of the reference second already passed, 0 - 999999
+        @param syncVals Receives the lead, the write latency and the estimated error, or NULL
+        @param timeFormat The TwelveHrFormat / TwentyFourHrFormat option parameter
+        @return Return boolean
+      */
+      boolean setEpochAligned(uint32_t epoch, uint32_t phase, struct syncParameters* syncVals = NULL,
+        uint8_t timeFormat = TwentyFourHrFormat);
+
+      /**
+        Get date and time, both alarms, control, status, aging and temperature
+        by reading all the registers 0x00 - 0x12 in a single transaction
+
+        @param snapVals Pointer reference of the snapshotParameters structure variable
+        @return Return boolean
+      */
+      boolean readSnapshot(struct snapshotParameters* snapVals);
+
       /**
         Set Alaram on every period of Seconds / Minutes / Hour
 
@@ -460,29 +950,49 @@ This library implements the following features:
       boolean setAlarm(uint8_t ss, uint8_t mm, uint8_t hh, uint8_t dyDt,
         boolean dy, boolean tf, boolean md, uint8_t alarm);
 
+      /**
+        Set Alarm from register values computed at compile time in a
+        single transaction, see Himadri_DS3231_AlarmSpec.h
+
+        @param spec The constexpr alarm specification
+        @return Return boolean
+      */
+      boolean setAlarm(const Himadri_DS3231_AlarmSpec& spec);
+
+      /**
+        Set Alarm1 matching date, hour, minutes and seconds of a Unix epoch
+        time in a single transaction
+
+        @param epoch Seconds since 1970/01/01 00:00:00
+        @param timeFormat The TwelveHrFormat / TwentyFourHrFormat option parameter
+        @return Return boolean
+      */
+      boolean setAlarmEpoch(uint32_t epoch, uint8_t timeFormat = TwentyFourHrFormat);
+
       /**
         Enable Alarm
 
         @param alarm Alarm choice unsigned integer value. It can be Alarm1 / Alarm2
-        @return Return void
+        @return Return boolean
       */
-      void enableAlarm(uint8_t alarm);
+      boolean enableAlarm(uint8_t alarm);
 
       /**
         Disable Alarm
 
         @param alarm Alarm choice unsigned integer value. It can be Alarm1 / Alarm2
-        @return Return void
+        @return Return boolean
       */
-      void disableAlarm(uint8_t);
+      boolean disableAlarm(uint8_t);
 
       /**
         Get Alarm status
 
         @param alarm Alarm choice unsigned integer value. It can be Alarm1 / Alarm2
+        @param cached True to answer from the shadow copy without a bus transaction
         @return Return boolean
       */
-      boolean alarmStatus(uint8_t alarm);
+      boolean alarmStatus(uint8_t alarm, boolean cached = false);
 
       /**
         Get Alarm time
@@ -497,10 +1007,28 @@ This library implements the following features:
         Get Temperature
 
         @param scale Temperature scale selection unsigned integer variable
-        @return Return float
+        @return Return float, NAN when the read failed
       */
       float readTemp(uint8_t scale = Celsius);
 
+      /**
+        Get Temperature as the 10 bit value of the chip without floating point
+
+        @param quarterDegrees Receives the temperature in 0.25 degree Celsius steps
+        @return Return boolean
+      */
+      boolean readTempRaw(int16_t* quarterDegrees);
+
+      /**
+        Get Temperature in hundredths of a degree without floating point.
+        Hundredths of a Kelvin go beyond 16 bit, so the value is 32 bit.
+
+        @param centiDegrees Receives the temperature in 0.01 degree steps
+        @param scale Temperature scale selection unsigned integer variable
+        @return Return boolean
+      */
+      boolean readTempCentiDegrees(int32_t* centiDegrees, uint8_t scale = Celsius);
+
       /**
         Force activate Temperature convertion by the chip
 
@@ -508,15 +1036,59 @@ This library implements the following features:
       */
       boolean convertTemp(void);
 
+      /**
+        Start a temperature conversion by writing CONV and return without
+        waiting for it to finish. CONV has no effect while the chip runs a
+        conversion of its own, so nothing is written while BSY is set.
+
+        @return Return boolean, false when BSY is set or the bus failed
+      */
+      boolean startConvertTemp(void);
+
+      /**
+        Check the conversion started by startConvertTemp. The chip is only
+        read when the poll interval has passed since the last read, so it
+        can be called on every pass of the main loop. A failed read of
+        CONV ends the conversion with ConvError.
+
+        @return Return ConvIdle / ConvBusy / ConvReady / ConvTimeout / ConvError
+      */
+      uint8_t pollConvertTemp(void);
+
+      /**
+        Get whether the last conversion finished and readTemp returns the new value
+
+        @return Return boolean
+      */
+      boolean tempReady(void);
+
+      /**
+        Set the cadence and the time limit of the conversion polling
+
+        @param interval Milliseconds between two reads of CONV
+        @param timeout Milliseconds after which the conversion is given up
+        @return Return void
+      */
+      void setConvertTempTiming(uint16_t interval, uint16_t timeout);
+
+      /**
+        Set the function called when the conversion becomes ready or times out
+
+        @param callback Function receiving ConvReady / ConvTimeout / ConvError, NULL to remove it
+        @return Return void
+      */
+      void onConvertTemp(void (*callback)(uint8_t state));
+
       /*-------------------------------
               Control Register
       -------------------------------*/
       /**
         Get Control Register value
 
-        @return Return the value of Control Register
+        @param cached True to answer from the shadow copy without a bus transaction
+        @return Return the value of Control Register, 0xFF when the read failed
       */
-      uint8_t controlRegValue(void);
+      uint8_t controlRegValue(boolean cached = false);
 
       /**
         Set EOSC bit on Control Register with 0 for start
@@ -531,14 +1103,15 @@ This library implements the following features:
         Get EOSC bit on Control Register with 0 for start
         and 1 for stop when the device switches to VBAT
 
+        @param cached True to answer from the shadow copy without a bus transaction
         @return Return the status of the oscillator in boolean
       */
-      boolean oscillatorStatus(void);
+      boolean oscillatorStatus(boolean cached = false);
 
       /**
         Set BBSQW bit on Control Register with 1 for start
         and 0 for stop with INTCN = 0 and VCC < VPF, enabling this generates
-        1Hz square wave
+        the square wave selected by setSQWFrequency on battery
 
         @param choice Enable / Disable choice using unsigned interger value
         @return Return boolean
@@ -550,16 +1123,36 @@ This library implements the following features:
         and 0 for stop with INTCN = 0 and VCC < VPF, enabling this generates
         1Hz square wave
 
+        @param cached True to answer from the shadow copy without a bus transaction
         @return Return the status of the BBSQW in boolean
       */
-      boolean bbsqwStatus(void);
+      boolean bbsqwStatus(boolean cached = false);
 
       /**
         Get INTCN bit on Control Register with 1 for enable and 0 for disable
 
+        @param cached True to answer from the shadow copy without a bus transaction
         @return Return the status of the INTCN in boolean
       */
-      boolean intcnStatus(void);
+      boolean intcnStatus(boolean cached = false);
+
+      /**
+        Set RS2 and RS1 bits on Control Register and clear INTCN so the
+        INT/SQW pin outputs the square wave. The alarms no longer drive
+        the pin until enableAlarm sets INTCN again.
+
+        @param freq SQW1Hz / SQW1024Hz / SQW4096Hz / SQW8192Hz choice
+        @return Return boolean
+      */
+      boolean setSQWFrequency(uint8_t freq);
+
+      /**
+        Get RS2 and RS1 bits on Control Register
+
+        @param cached True to answer from the shadow copy without a bus transaction
+        @return Return SQW1Hz / SQW1024Hz / SQW4096Hz / SQW8192Hz
+      */
+      uint8_t sqwFrequency(boolean cached = false);
 
       /*-------------------------------
               Status Register
@@ -567,17 +1160,21 @@ This library implements the following features:
       /**
         Get Status Register value
 
-        @return Return the value of Status Register
+        @param cached True to answer from the shadow copy without a bus transaction.
+          Hardware flags in the copy are as old as the last read.
+        @return Return the value of Status Register, 0xFF when the read failed
       */
-      uint8_t statusRegValue(void);
+      uint8_t statusRegValue(boolean cached = false);
 
       /**
         Get OSF (Oscillator stop flag) bit on Status Register with 1 for stop
         and 0 for start
 
+        @param cached True to answer from the shadow copy without a bus transaction.
+          Hardware flags in the copy are as old as the last read.
         @return Return boolean
       */
-      boolean osfStatus(void);
+      boolean osfStatus(boolean cached = false);
 
       /**
         Set EN32KHZ bit on Status Register with 0 for disable and 1 for enable.
@@ -591,16 +1188,19 @@ This library implements the following features:
       /**
         Get EN32KHZ bit on Status Register with 1 for start and 0 for stop
 
+        @param cached True to answer from the shadow copy without a bus transaction
         @return Return boolean
       */
-      boolean en32KhzStatus(void);
+      boolean en32KhzStatus(boolean cached = false);
 
       /**
         Get Temperature Busy Status
 
+        @param cached True to answer from the shadow copy without a bus transaction.
+          Hardware flags in the copy are as old as the last read.
         @return Return void
       */
-      boolean bsyStatus(void);
+      boolean bsyStatus(boolean cached = false);
 
       /*-------------------------------
               Aging Register
@@ -623,7 +1223,7 @@ This library implements the following features:
       boolean setAgingRegValue(int8_t val);
   };
 
-#endif;
+#endif
 
 /******************************
          DS3231 RTC
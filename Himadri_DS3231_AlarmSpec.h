@@ -0,0 +1,244 @@
+/******************************
+     DS3231 RTC Alarm Specification
+
+Alarm1 / Alarm2 register values computed by the compiler. A constexpr
+specification encodes the BCD values, the A1M1 - A1M4 / A2M2 - A2M4 mask
+bits, DY/DT and the 12 / 24 hour bits once at build time, so
+Himadri_DS3231::setAlarm(spec) only writes the bytes in one transaction.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+This class implements the following features:
+  1. The same alarms as the setAlarm overloads, as constexpr values
+  2. Out of range values are compile errors for constexpr specifications
+     and give an invalid specification that setAlarm(spec) rejects otherwise
+
+  constexpr Himadri_DS3231_AlarmSpec wake =
+    Himadri_DS3231_AlarmSpec::match(0, 30, 6, false, false, Alarm1);
+
+  ds3231.setAlarm(wake);
+
+******************************/
+
+/**
+    Himadri_DS3231_AlarmSpec.h
+    Purpose: Alarm register values computed at compile time, used by Himadri_DS3231::setAlarm.
+*/
+
+#ifndef HIMADRI_DS3231_ALARM_SPEC_H
+
+  #define HIMADRI_DS3231_ALARM_SPEC_H
+
+  #include "Himadri_DS3231.h"
+
+  /*-------------------------------
+     Invalid Alarm Register Value
+  -------------------------------*/
+  #define DS3231_ALARM_SPEC_INVALID   0xFF
+  /*-------------------------------
+     Invalid Alarm Register Value
+  -------------------------------*/
+
+  class Himadri_DS3231_AlarmSpec {
+    /*-------------------------------
+      Private Function Declaration
+    -------------------------------*/
+    private:
+      /**
+        Not constexpr, so an out of range value in a constexpr
+        specification fails the build at the call of this function
+
+        @return Return DS3231_ALARM_SPEC_INVALID
+      */
+      static uint8_t alarmValueOutOfRange(void) {
+        return DS3231_ALARM_SPEC_INVALID;
+      }
+
+      /**
+        Returns the BCD value when it is within 0 - max
+
+        @param value The value in Decimal
+        @param max The largest allowed value
+        @return Return the BCD value
+      */
+      static constexpr uint8_t bcd(uint8_t value, uint8_t max) {
+        return value <= max ? (uint8_t)((value / 10 << 4) | (value % 10)) : alarmValueOutOfRange();
+      }
+
+      /**
+        Returns the hour register with time format and meridian
+
+        @param hh Unsigned integer value for Hour
+        @param tf Boolean for Timeformat 12 / 24. True for 12 and false for 24
+        @param md Boolean for Meridian AM / PM. True for PM and false for AM
+        @return Return the register value
+      */
+      static constexpr uint8_t hour(uint8_t hh, boolean tf, boolean md) {
+        return tf == false ? bcd(hh, 23) :
+          hh >= 1 ? (uint8_t)(bcd(hh, 12) | (md ? 0x60 : 0x40)) :   // 01100000 / 01000000
+          alarmValueOutOfRange();
+      }
+
+      /**
+        Returns the day / date register
+
+        @param dyDt Unsigned integer value for Day 1 - 7 / Date 1 - 31
+        @param dy Boolean for Day or Date selection. True for Day and false for Date
+        @return Return the register value
+      */
+      static constexpr uint8_t dayDate(uint8_t dyDt, boolean dy) {
+        return dyDt == 0 ? alarmValueOutOfRange() :
+          dy ? (uint8_t)(bcd(dyDt, 7) | 0x40) :                     // 01000000
+          bcd(dyDt, 31);
+      }
+
+      /**
+        Returns the register for a periodicity, 0x80 when it is masked
+
+        @param periodicity The Second / Minute / Hour choice
+        @param field The Second / Minute / Hour register of the value
+        @param value The register value when the field is matched
+        @return Return the register value
+      */
+      static constexpr uint8_t period(uint8_t periodicity, uint8_t field, uint8_t value) {
+        return periodicity < Second || periodicity > Hour ? alarmValueOutOfRange() :
+          field < periodicity ? 0x00 :                              // 00000000
+          field == periodicity ? value :
+          0x80;                                                     // 10000000
+      }
+
+      /**
+        Returns true when none of the registers is invalid
+
+        @return Return boolean
+      */
+      static constexpr boolean validRegisters(uint8_t r0, uint8_t r1, uint8_t r2, uint8_t r3) {
+        return r0 != DS3231_ALARM_SPEC_INVALID && r1 != DS3231_ALARM_SPEC_INVALID &&
+          r2 != DS3231_ALARM_SPEC_INVALID && r3 != DS3231_ALARM_SPEC_INVALID;
+      }
+
+    /*-------------------------------
+      Public Function Declaration
+    -------------------------------*/
+    public:
+      uint8_t alarm;              // Alarm1 / Alarm2
+      uint8_t reg[4];             // values from the Alarm1 Seconds / Alarm2 Minutes Register
+      uint8_t len;                // registers to write, 0 when the specification is invalid
+
+      /**
+        Create the specification from the Alarm1 register layout, Alarm2
+        drops the seconds register
+
+        @param a Alarm choice unsigned integer value. It can be Alarm1 / Alarm2
+        @param ss Seconds register value
+        @param mm Minutes register value
+        @param hh Hour register value
+        @param dd Day / Date register value
+      */
+      constexpr Himadri_DS3231_AlarmSpec(uint8_t a, uint8_t ss, uint8_t mm, uint8_t hh, uint8_t dd) :
+        alarm(a == Alarm1 || a == Alarm2 ? a : alarmValueOutOfRange()),
+        reg{a == Alarm2 ? mm : ss, a == Alarm2 ? hh : mm, a == Alarm2 ? dd : hh, a == Alarm2 ? (uint8_t)0 : dd},
+        len(validRegisters(a == Alarm2 ? 0 : ss, mm, hh, dd) == false ? 0 :
+          a == Alarm1 ? 4 : a == Alarm2 ? 3 : 0) {
+      }
+
+      /**
+        Alarm on every period of Seconds / Minutes / Hour
+
+        @param periodicity The Second / Minute / Hour choice, Alarm2 can not match every Second
+        @param alarm Alarm choice unsigned integer value. It can be Alarm1 / Alarm2
+        @return Return the specification
+      */
+      static constexpr Himadri_DS3231_AlarmSpec every(uint8_t periodicity, uint8_t alarm) {
+        return Himadri_DS3231_AlarmSpec(alarm,
+          period(periodicity, Second, 0x80),
+          periodicity == Second && alarm == Alarm2 ? alarmValueOutOfRange() : period(periodicity, Minute, 0x80),
+          period(periodicity, Hour, 0x80),
+          0x80);
+      }
+
+      /**
+        Alarm matching for exact Seconds / Minutes / Hour with time format and meridian
+
+        @param periodicity The Second / Minute / Hour choice, Alarm2 can not match Seconds
+        @param val Unsigned integer value for the periodicity
+        @param tf Boolean for Timeformat 12 / 24. True for 12 and false for 24
+        @param md Boolean for Meridian AM / PM. True for PM and false for AM
+        @param alarm Alarm choice unsigned integer value. It can be Alarm1 / Alarm2
+        @return Return the specification
+      */
+      static constexpr Himadri_DS3231_AlarmSpec exact(uint8_t periodicity, uint8_t val,
+        boolean tf, boolean md, uint8_t alarm) {
+        return Himadri_DS3231_AlarmSpec(alarm,
+          period(periodicity, Second, periodicity == Second ? bcd(val, 59) : 0),
+          periodicity == Second && alarm == Alarm2 ? alarmValueOutOfRange() :
+            period(periodicity, Minute, periodicity == Minute ? bcd(val, 59) : 0),
+          period(periodicity, Hour, periodicity == Hour ? hour(val, tf, md) : 0),
+          0x80);
+      }
+
+      /**
+        Alarm1 matching Seconds and Minutes
+
+        @param ss Unsigned integer value for Seconds
+        @param mm Unsigned integer value for Minutes
+        @return Return the specification
+      */
+      static constexpr Himadri_DS3231_AlarmSpec match(uint8_t ss, uint8_t mm) {
+        return Himadri_DS3231_AlarmSpec(Alarm1, bcd(ss, 59), bcd(mm, 59), 0x80, 0x80);
+      }
+
+      /**
+        Alarm matching Seconds, Minutes and Hour, Alarm2 ignores the Seconds
+
+        @param ss Unsigned integer value for Seconds
+        @param mm Unsigned integer value for Minutes
+        @param hh Unsigned integer value for Hour
+        @param tf Boolean for Timeformat 12 / 24. True for 12 and false for 24
+        @param md Boolean for Meridian AM / PM. True for PM and false for AM
+        @param alarm Alarm choice unsigned integer value. It can be Alarm1 / Alarm2
+        @return Return the specification
+      */
+      static constexpr Himadri_DS3231_AlarmSpec match(uint8_t ss, uint8_t mm, uint8_t hh,
+        boolean tf, boolean md, uint8_t alarm) {
+        return Himadri_DS3231_AlarmSpec(alarm, alarm == Alarm2 ? 0 : bcd(ss, 59), bcd(mm, 59),
+          hour(hh, tf, md), 0x80);
+      }
+
+      /**
+        Alarm matching Day / Date, Hour, Minutes and Seconds, Alarm2 ignores the Seconds
+
+        @param ss Unsigned integer value for Seconds
+        @param mm Unsigned integer value for Minutes
+        @param hh Unsigned integer value for Hour
+        @param dyDt Unsigned integer value for Day / Date
+        @param dy Boolean for Day or Date selection. True for Day and false for Date
+        @param tf Boolean for Timeformat 12 / 24. True for 12 and false for 24
+        @param md Boolean for Meridian AM / PM. True for PM and false for AM
+        @param alarm Alarm choice unsigned integer value. It can be Alarm1 / Alarm2
+        @return Return the specification
+      */
+      static constexpr Himadri_DS3231_AlarmSpec match(uint8_t ss, uint8_t mm, uint8_t hh,
+        uint8_t dyDt, boolean dy, boolean tf, boolean md, uint8_t alarm) {
+        return Himadri_DS3231_AlarmSpec(alarm, alarm == Alarm2 ? 0 : bcd(ss, 59), bcd(mm, 59),
+          hour(hh, tf, md), dayDate(dyDt, dy));
+      }
+
+      /**
+        Returns true when the specification can be written
+
+        @return Return boolean
+      */
+      constexpr boolean isValid(void) const {
+        return len != 0;
+      }
+  };
+
+#endif
+
+/******************************
+     DS3231 RTC Alarm Specification
+******************************/
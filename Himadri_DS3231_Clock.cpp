@@ -0,0 +1,196 @@
+/******************************
+     DS3231 RTC Software Clock
+
+Millisecond clock extrapolated from a single DS3231 read with millis().
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+******************************/
+
+#include "Himadri_DS3231_Clock.h"
+
+/*-------------------------------
+  Private Function Definition
+-------------------------------*/
+
+/**
+  Advance the current second to the millis() value.
+**/
+void Himadri_DS3231_Clock::advance(unsigned long t) {
+  // Normally runs at most once per call, so no division on the hot path
+  while(t - secStartMillis >= 1000UL) {
+    secStartMillis += 1000UL;
+    curEpoch++;
+  }
+};
+
+/**
+  Read the chip once and pull the extrapolated clock into the second
+  reported by the chip.
+**/
+boolean Himadri_DS3231_Clock::resync() {
+  uint32_t epoch;
+  unsigned long t = millis();
+
+  if(rtc->readEpoch(&epoch) == false) {
+    return fail(t);
+  }
+  syncMillis = t;
+  failures = 0;
+  advance(t);
+
+  if(curEpoch < epoch) {
+    // Running slow, the chip second started no later than now
+    curEpoch = epoch;
+    secStartMillis = t;
+  } else if(curEpoch > epoch) {
+    // Running fast, the chip second ends no earlier than now
+    curEpoch = epoch;
+    secStartMillis = t - 999UL;
+  }
+  return true;
+};
+
+/**
+  Count a failed sync.
+**/
+boolean Himadri_DS3231_Clock::fail(unsigned long t) {
+  failMillis = t;
+  if(failures < 0xFF) {
+    failures++;
+  }
+  return false;
+};
+
+/*-------------------------------
+  Public Function Definition
+-------------------------------*/
+
+/**
+  Create the clock on top of an initialized DS3231.
+**/
+Himadri_DS3231_Clock::Himadri_DS3231_Clock(Himadri_DS3231& ds3231, uint32_t interval) {
+  rtc = &ds3231;
+  resyncInterval = interval;
+  curEpoch = 0;
+  secStartMillis = 0;
+  syncMillis = 0;
+  failMillis = 0;
+  failures = 0;
+  synced = false;
+};
+
+/**
+  Sync with the chip.
+**/
+boolean Himadri_DS3231_Clock::sync(boolean align) {
+  uint32_t first, epoch;
+  unsigned long t = millis();
+
+  if(rtc->readEpoch(&first) == false) {
+    synced = false;
+    return fail(t);
+  }
+  epoch = first;
+
+  if(align == true) {
+    unsigned long start = t;
+    // The rollover happened between the previous read and this one
+    while(epoch == first && millis() - start < 1100UL) {
+      delay(DS3231_CLOCK_POLL_MS);
+      t = millis();
+      if(rtc->readEpoch(&epoch) == false) {
+        synced = false;
+        return fail(t);
+      }
+    }
+    // No rollover, the oscillator is stopped
+    if(epoch == first) {
+      synced = false;
+      return fail(t);
+    }
+  }
+
+  curEpoch = epoch;
+  secStartMillis = t;
+  syncMillis = t;
+  failures = 0;
+  synced = true;
+  return true;
+};
+
+/**
+  Get current time.
+**/
+uint32_t Himadri_DS3231_Clock::now() {
+  uint16_t ms;
+  return now(&ms);
+};
+
+/**
+  Get current time with milliseconds.
+**/
+uint32_t Himadri_DS3231_Clock::now(uint16_t* ms) {
+  unsigned long t = millis();
+
+  if(failures != 0 && t - failMillis < DS3231_CLOCK_RETRY_MS) {
+    // Keep running on millis() until the retry
+  } else if(synced == false) {
+    sync();
+    t = millis();
+  } else if(resyncInterval != 0 && t - syncMillis >= resyncInterval) {
+    resync();
+    t = millis();
+  }
+
+  advance(t);
+  *ms = (uint16_t)(t - secStartMillis);
+  return curEpoch;
+};
+
+/**
+  Set the interval between two resyncs.
+**/
+void Himadri_DS3231_Clock::setResyncInterval(uint32_t interval) {
+  resyncInterval = interval;
+};
+
+/**
+  Get whether the clock holds a time read from the chip.
+**/
+boolean Himadri_DS3231_Clock::isSynced() {
+  return synced;
+};
+
+/**
+  Get the number of failed syncs since the last successful one.
+**/
+uint8_t Himadri_DS3231_Clock::syncFailures() {
+  return failures;
+};
+
+/**
+  Forget the synced time.
+**/
+void Himadri_DS3231_Clock::invalidate() {
+  synced = false;
+  failures = 0;
+};
+
+/**
+  Set the clock from a known second start.
+**/
+void Himadri_DS3231_Clock::setSecondStart(uint32_t epoch, unsigned long edgeMillis) {
+  curEpoch = epoch;
+  secStartMillis = edgeMillis;
+  syncMillis = edgeMillis;
+  failures = 0;
+  synced = true;
+};
+
+/******************************
+     DS3231 RTC Software Clock
+******************************/
@@ -0,0 +1,172 @@
+/******************************
+     DS3231 RTC Software Clock
+
+Millisecond clock extrapolated from a single DS3231 read with millis(),
+so timestamps cost a few instructions instead of an I2C transaction.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+This class implements the following features:
+  1. Sync with the DS3231 on the seconds rollover for millisecond phase
+  2. Current time as Unix epoch seconds plus milliseconds without I2C
+  3. Periodic resync on a configurable interval that corrects millis()
+     drift while keeping the millisecond phase
+  4. Failed syncs retried from now() at most every DS3231_CLOCK_RETRY_MS
+
+******************************/
+
+/**
+    Himadri_DS3231_Clock.h
+    Purpose: Header file for Himadri_DS3231_Clock.cpp. Contains the all function declaration.
+*/
+
+#ifndef HIMADRI_DS3231_CLOCK_H
+
+  #define HIMADRI_DS3231_CLOCK_H
+
+  #include "Himadri_DS3231.h"
+
+  /*-------------------------------
+    Default Resync Interval In ms
+  -------------------------------*/
+  #define DS3231_CLOCK_RESYNC_MS      60000UL
+  /*-------------------------------
+    Default Resync Interval In ms
+  -------------------------------*/
+
+  /*-------------------------------
+      Sync Poll And Retry In ms
+  -------------------------------*/
+  #define DS3231_CLOCK_POLL_MS        1U          // between two reads waiting for the rollover
+  #define DS3231_CLOCK_RETRY_MS       1000UL      // between two syncs from now() after a failure
+  /*-------------------------------
+      Sync Poll And Retry In ms
+  -------------------------------*/
+
+  class Himadri_DS3231_Clock {
+    /*-------------------------------
+      Private Function Declaration
+    -------------------------------*/
+    private:
+      Himadri_DS3231* rtc;
+      uint32_t curEpoch;                  // epoch seconds of the current second
+      unsigned long secStartMillis;       // millis() when the current second started
+      unsigned long syncMillis;           // millis() of the last sync with the chip
+      uint32_t resyncInterval;            // milliseconds between two syncs, 0 for never
+      unsigned long failMillis;           // millis() of the last failed sync
+      uint8_t failures;                   // failed syncs since the last successful one
+      boolean synced;
+
+      /**
+        Advance the current second to the millis() value
+
+        @param t The millis() value
+        @return Return void
+      */
+      void advance(unsigned long t);
+
+      /**
+        Read the chip once and pull the extrapolated clock into the second
+        reported by the chip, keeping the millisecond phase when it fits
+
+        @return Return boolean
+      */
+      boolean resync(void);
+
+      /**
+        Count a failed sync
+
+        @param t The millis() value of the attempt
+        @return Return boolean, always false
+      */
+      boolean fail(unsigned long t);
+
+    /*-------------------------------
+      Public Function Declaration
+    -------------------------------*/
+    public:
+      /**
+        Create the clock on top of an initialized DS3231
+
+        @param ds3231 The DS3231 driver used for syncing
+        @param interval Milliseconds between two resyncs, 0 for never
+      */
+      Himadri_DS3231_Clock(Himadri_DS3231& ds3231, uint32_t interval = DS3231_CLOCK_RESYNC_MS);
+
+      /**
+        Sync with the chip. With alignment it waits for the next seconds
+        rollover, up to one second, which gives the millisecond phase. The
+        chip is read every DS3231_CLOCK_POLL_MS while waiting.
+
+        @param align True to wait for the seconds rollover
+        @return Return boolean, false when a read failed or no rollover was seen
+      */
+      boolean sync(boolean align = true);
+
+      /**
+        Get current time, syncing first if the clock was never synced or
+        the resync interval has passed. After a failed sync the clock keeps
+        running on millis() and the next sync waits DS3231_CLOCK_RETRY_MS.
+
+        @return Return Unix epoch seconds
+      */
+      uint32_t now(void);
+
+      /**
+        Get current time with milliseconds
+
+        @param ms Pointer reference receiving the milliseconds 0 - 999
+        @return Return Unix epoch seconds
+      */
+      uint32_t now(uint16_t* ms);
+
+      /**
+        Set the interval between two resyncs
+
+        @param interval Milliseconds between two resyncs, 0 for never
+        @return Return void
+      */
+      void setResyncInterval(uint32_t interval);
+
+      /**
+        Get whether the clock holds a time read from the chip
+
+        @return Return boolean
+      */
+      boolean isSynced(void);
+
+      /**
+        Get the number of failed syncs since the last successful one
+
+        @return Return the failures, 0 - 255
+      */
+      uint8_t syncFailures(void);
+
+      /**
+        Forget the synced time so the next call to now() syncs again.
+        Call it after setting the time on the chip.
+
+        @return Return void
+      */
+      void invalidate(void);
+
+      /**
+        Set the clock from a second start known without reading the chip,
+        e.g. the alarm interrupt edge that woke the MCU after millis() was
+        stopped in sleep. The clock counts as synced from that edge.
+
+        @param epoch Unix epoch seconds of the second starting at the edge
+        @param edgeMillis The millis() value at the edge
+        @return Return void
+      */
+      void setSecondStart(uint32_t epoch, unsigned long edgeMillis);
+  };
+
+#endif
+
+/******************************
+     DS3231 RTC Software Clock
+******************************/
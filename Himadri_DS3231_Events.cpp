@@ -0,0 +1,165 @@
+/******************************
+     DS3231 RTC Alarm Events
+
+Interrupt dispatcher for the Alarm1 / Alarm2 interrupt on the INT/SQW pin.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+******************************/
+
+#include "Himadri_DS3231_Events.h"
+
+#if (DS3231_EVENT_QUEUE & (DS3231_EVENT_QUEUE - 1)) != 0 || DS3231_EVENT_QUEUE > 128
+  #error "DS3231_EVENT_QUEUE must be a power of 2 up to 128"
+#endif
+
+volatile unsigned long Himadri_DS3231_Events::ring[DS3231_EVENT_QUEUE];
+volatile uint8_t Himadri_DS3231_Events::head = 0;
+volatile uint8_t Himadri_DS3231_Events::tail = 0;
+volatile uint8_t Himadri_DS3231_Events::dropped = 0;
+
+/*-------------------------------
+  Private Function Definition
+-------------------------------*/
+
+/**
+  Interrupt handler pushing the edge into the ring.
+**/
+void Himadri_DS3231_Events::isr() {
+  uint8_t next = (head + 1) & (DS3231_EVENT_QUEUE - 1);
+
+  if(next == tail) {
+    if(dropped != 0xFF) {
+      dropped++;
+    }
+    return;
+  }
+  // The slot is written before head publishes it to pump()
+  ring[head] = micros();
+  head = next;
+};
+
+/*-------------------------------
+  Public Function Definition
+-------------------------------*/
+
+/**
+  Create the dispatcher for a DS3231.
+**/
+Himadri_DS3231_Events::Himadri_DS3231_Events(Himadri_DS3231& ds3231) {
+  rtc = &ds3231;
+  intPin = 0xFF;
+  handlers[0] = NULL;
+  handlers[1] = NULL;
+};
+
+/**
+  Attach the interrupt to the pin wired to INT/SQW.
+**/
+void Himadri_DS3231_Events::begin(uint8_t pin) {
+  end();
+  intPin = pin;
+  pinMode(intPin, INPUT_PULLUP);
+
+  noInterrupts();
+  head = 0;
+  tail = 0;
+  dropped = 0;
+  interrupts();
+
+  attachInterrupt(digitalPinToInterrupt(intPin), isr, FALLING);
+
+  // A pending alarm holds INT low, no falling edge will announce it
+  if(digitalRead(intPin) == LOW) {
+    noInterrupts();
+    isr();
+    interrupts();
+  }
+};
+
+/**
+  Detach the interrupt.
+**/
+void Himadri_DS3231_Events::end() {
+  if(intPin != 0xFF) {
+    detachInterrupt(digitalPinToInterrupt(intPin));
+    intPin = 0xFF;
+  }
+};
+
+/**
+  Register the handler of an alarm.
+**/
+boolean Himadri_DS3231_Events::onAlarm(uint8_t alarm, void (*handler)(uint8_t alarm, unsigned long edgeMicros)) {
+  if(alarm != Alarm1 && alarm != Alarm2) {
+    return false;
+  }
+  handlers[alarm - 1] = handler;
+  return true;
+};
+
+/**
+  Take the queued edges and dispatch the fired alarms.
+**/
+uint8_t Himadri_DS3231_Events::pump() {
+  uint8_t last = head;
+  uint8_t alarms;
+  unsigned long edgeMicros;
+
+  if(last == tail) {
+    return 0;
+  }
+  // The flags of all queued edges are read at once, INT went low on the oldest edge
+  edgeMicros = ring[tail];
+
+  // On a failed read the edges stay queued and the next pump tries again
+  if(rtc->readClearAlarmStatus(&alarms) == false) {
+    return 0;
+  }
+  tail = last;
+
+  if((alarms & Alarm1) && handlers[0] != NULL) {
+    handlers[0](Alarm1, edgeMicros);
+  }
+  if((alarms & Alarm2) && handlers[1] != NULL) {
+    handlers[1](Alarm2, edgeMicros);
+  }
+
+  // A flag set while INT was already low gave no edge, it still holds the pin low
+  if(intPin != 0xFF && digitalRead(intPin) == LOW) {
+    noInterrupts();
+    isr();
+    interrupts();
+  }
+
+  return alarms;
+};
+
+/**
+  Get the number of queued edges.
+**/
+uint8_t Himadri_DS3231_Events::pending() {
+  return (head - tail) & (DS3231_EVENT_QUEUE - 1);
+};
+
+/**
+  Get the number of edges lost because the ring was full.
+**/
+uint8_t Himadri_DS3231_Events::droppedEvents() {
+  noInterrupts();
+  uint8_t count = dropped;
+  dropped = 0;
+  interrupts();
+  return count;
+};
+
+/*-------------------------------
+  Public Function Definition
+-------------------------------*/
+
+/******************************
+     DS3231 RTC Alarm Events
+******************************/
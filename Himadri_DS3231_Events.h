@@ -0,0 +1,137 @@
+/******************************
+     DS3231 RTC Alarm Events
+
+Interrupt dispatcher for the Alarm1 / Alarm2 interrupt on the INT/SQW pin.
+The interrupt handler only stores the micros() of the falling edge in a
+lock-free single producer / single consumer ring. The I2C work is done in
+pump(), called from loop(), which reads the Status Register once, clears
+A1F / A2F in the same write and calls the registered handlers.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+This class implements the following features:
+  1. No I2C traffic and no blocking call in interrupt context
+  2. One Status Register read and at most one write per pump, only the
+     flags found set are cleared so an alarm firing in between is kept
+  3. Handlers per alarm called with the micros() of the interrupt edge
+  4. Count of the edges lost to a full ring
+
+Only one instance can be active at a time because the interrupt handler
+has no context.
+
+******************************/
+
+/**
+    Himadri_DS3231_Events.h
+    Purpose: Header file for Himadri_DS3231_Events.cpp. Contains the all function declaration.
+*/
+
+#ifndef HIMADRI_DS3231_EVENTS_H
+
+  #define HIMADRI_DS3231_EVENTS_H
+
+  #include "Himadri_DS3231.h"
+
+  /*-------------------------------
+      Event Ring Size, Power Of 2
+  -------------------------------*/
+  #ifndef DS3231_EVENT_QUEUE
+    #define DS3231_EVENT_QUEUE        8
+  #endif
+  /*-------------------------------
+      Event Ring Size, Power Of 2
+  -------------------------------*/
+
+  class Himadri_DS3231_Events {
+    /*-------------------------------
+      Private Function Declaration
+    -------------------------------*/
+    private:
+      Himadri_DS3231* rtc;
+      uint8_t intPin;                                 // pin wired to INT/SQW
+      void (*handlers[2])(uint8_t alarm, unsigned long edgeMicros);
+
+      // The interrupt handler only writes head, pump() only writes tail
+      static volatile unsigned long ring[DS3231_EVENT_QUEUE];   // micros() of every edge
+      static volatile uint8_t head;
+      static volatile uint8_t tail;
+      static volatile uint8_t dropped;
+
+      /**
+        Interrupt handler pushing the edge into the ring
+
+        @return Return void
+      */
+      static void isr(void);
+
+    /*-------------------------------
+      Public Function Declaration
+    -------------------------------*/
+    public:
+      /**
+        Create the dispatcher for a DS3231
+
+        @param ds3231 The DS3231 driver used to read and clear the flags
+      */
+      Himadri_DS3231_Events(Himadri_DS3231& ds3231);
+
+      /**
+        Attach the interrupt to the pin wired to INT/SQW. The pin is an open
+        drain output so the internal pull-up is enabled. An alarm already
+        pending holds the pin low and is queued for the first pump.
+
+        @param pin The pin wired to INT/SQW, it must support interrupts
+        @return Return void
+      */
+      void begin(uint8_t pin);
+
+      /**
+        Detach the interrupt
+
+        @return Return void
+      */
+      void end(void);
+
+      /**
+        Register the handler of an alarm, NULL removes it
+
+        @param alarm Alarm choice unsigned integer value. It can be Alarm1 / Alarm2
+        @param handler Function called with the alarm and the micros() of the edge
+        @return Return boolean
+      */
+      boolean onAlarm(uint8_t alarm, void (*handler)(uint8_t alarm, unsigned long edgeMicros));
+
+      /**
+        Take the queued edges, read and clear the alarm flags once and call
+        the handlers of the fired alarms. Without queued edges there is no
+        I2C traffic. When the read fails the edges stay queued, and when INT
+        is still low after the clear an edge is queued for the next pump.
+
+        @return Return the fired alarms, 0 / Alarm1 / Alarm2 / BothAlarm
+      */
+      uint8_t pump(void);
+
+      /**
+        Get the number of queued edges
+
+        @return Return unsigned integer
+      */
+      uint8_t pending(void);
+
+      /**
+        Get the number of edges lost because the ring was full, the count
+        is reset on read
+
+        @return Return unsigned integer
+      */
+      uint8_t droppedEvents(void);
+  };
+
+#endif
+
+/******************************
+     DS3231 RTC Alarm Events
+******************************/
@@ -0,0 +1,165 @@
+/******************************
+   DS3231 RTC Linux Transport
+
+Transport of the DS3231 driver over the Linux i2c-dev interface.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+******************************/
+
+#if defined(__linux__)
+
+#include "Himadri_DS3231_LinuxTransport.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+/**
+  The system ioctl() with the fixed argument of the i2c-dev requests.
+**/
+static int systemIoctl(int fd, unsigned long request, void* arg) {
+  return ioctl(fd, request, arg);
+}
+
+/*-------------------------------
+  Private Function Definition
+-------------------------------*/
+
+/**
+  Run the messages as one combined transaction.
+**/
+uint8_t Himadri_DS3231_LinuxTransport::transfer(struct i2c_msg* msgs, uint8_t count) {
+  struct i2c_rdwr_ioctl_data data;
+
+  if(fd < 0) {
+    return DS3231_BUS_ERROR;
+  }
+  data.msgs = msgs;
+  data.nmsgs = count;
+  if(i2cIoctl(fd, I2C_RDWR, &data) < 0) {
+    // The adapters report a missing ACK as ENXIO or EREMOTEIO
+    if(errno == ENXIO || errno == EREMOTEIO) {
+      return DS3231_BUS_NACK_ADDRESS;
+    }
+    return DS3231_BUS_ERROR;
+  }
+  return DS3231_BUS_OK;
+};
+
+/*-------------------------------
+  Public Function Definition
+-------------------------------*/
+
+/**
+  Create the transport on an i2c-dev node.
+**/
+Himadri_DS3231_LinuxTransport::Himadri_DS3231_LinuxTransport(const char* device, uint8_t address, i2cIoctlFunction ioctlFunction) {
+  devicePath = device;
+  fd = -1;
+  ownsFd = false;
+  deviceAddress = address;
+  i2cIoctl = ioctlFunction != NULL ? ioctlFunction : systemIoctl;
+};
+
+/**
+  Create the transport on an already open file descriptor.
+**/
+Himadri_DS3231_LinuxTransport::Himadri_DS3231_LinuxTransport(int descriptor, uint8_t address, i2cIoctlFunction ioctlFunction) {
+  devicePath = NULL;
+  fd = descriptor;
+  ownsFd = false;
+  deviceAddress = address;
+  i2cIoctl = ioctlFunction != NULL ? ioctlFunction : systemIoctl;
+};
+
+/**
+  Open the i2c-dev node.
+**/
+void Himadri_DS3231_LinuxTransport::begin() {
+  if(fd >= 0 || devicePath == NULL) {
+    return;
+  }
+  fd = open(devicePath, O_RDWR);
+  ownsFd = fd >= 0;
+};
+
+/**
+  Close the i2c-dev node opened by begin().
+**/
+void Himadri_DS3231_LinuxTransport::end() {
+  if(ownsFd) {
+    close(fd);
+    fd = -1;
+    ownsFd = false;
+  }
+};
+
+/**
+  Returns true when the file descriptor is open.
+**/
+boolean Himadri_DS3231_LinuxTransport::isOpen() {
+  return fd >= 0;
+};
+
+/**
+  Address the device with a one byte read of the Seconds Register, adapters
+  flagged I2C_AQ_NO_ZERO_LEN reject an empty write.
+**/
+uint8_t Himadri_DS3231_LinuxTransport::probe() {
+  uint8_t value;
+
+  return readRegisters(0x00, &value, 1);
+};
+
+/**
+  Write the register address and read the registers with a repeated START.
+**/
+uint8_t Himadri_DS3231_LinuxTransport::readRegisters(uint8_t regaddress, uint8_t* buf, uint8_t len) {
+  struct i2c_msg msgs[2];
+
+  msgs[0].addr = deviceAddress;
+  msgs[0].flags = 0;
+  msgs[0].len = 1;
+  msgs[0].buf = &regaddress;
+  msgs[1].addr = deviceAddress;
+  msgs[1].flags = I2C_M_RD;
+  msgs[1].len = len;
+  msgs[1].buf = buf;
+  return transfer(msgs, 2);
+};
+
+/**
+  Write the register address followed by the register values.
+**/
+uint8_t Himadri_DS3231_LinuxTransport::writeRegisters(uint8_t regaddress, const uint8_t* buf, uint8_t len) {
+  uint8_t data[DS3231_LINUX_BUFFER_LENGTH + 1];
+  struct i2c_msg msg;
+
+  if(len > DS3231_LINUX_BUFFER_LENGTH) {
+    return DS3231_BUS_TOO_LONG;
+  }
+  data[0] = regaddress;
+  memcpy(data + 1, buf, len);
+  msg.addr = deviceAddress;
+  msg.flags = 0;
+  msg.len = len + 1;
+  msg.buf = data;
+  return transfer(&msg, 1);
+};
+
+/*-------------------------------
+  Public Function Definition
+-------------------------------*/
+
+#endif
+
+/******************************
+   DS3231 RTC Linux Transport
+******************************/
@@ -0,0 +1,116 @@
+/******************************
+   DS3231 RTC Linux Transport
+
+Transport of the DS3231 driver over the Linux i2c-dev interface
+(/dev/i2c-N). Every register access is a single I2C_RDWR ioctl, so the
+register address write and the burst read are one repeated START
+transaction and one system call.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+******************************/
+
+/**
+    Himadri_DS3231_LinuxTransport.h
+    Purpose: Header file for Himadri_DS3231_LinuxTransport.cpp. Contains the all function declaration.
+*/
+
+#ifndef HIMADRI_DS3231_LINUX_TRANSPORT_H
+
+  #define HIMADRI_DS3231_LINUX_TRANSPORT_H
+
+  #if defined(__linux__)
+
+    #include "Himadri_DS3231_Transport.h"
+
+    struct i2c_msg;
+
+    /*-------------------------------
+      Largest Register Write In Bytes
+    -------------------------------*/
+    #define DS3231_LINUX_BUFFER_LENGTH  32
+    /*-------------------------------
+      Largest Register Write In Bytes
+    -------------------------------*/
+
+    // ioctl() of the i2c-dev node, replaceable e.g. by the host stand-in
+    typedef int (*i2cIoctlFunction)(int fd, unsigned long request, void* arg);
+
+    class Himadri_DS3231_LinuxTransport : public Himadri_DS3231_Transport {
+      /*-------------------------------
+        Private Function Declaration
+      -------------------------------*/
+      private:
+        const char* devicePath;           // i2c-dev node opened by begin()
+        int fd;                           // open file descriptor, -1 when closed
+        boolean ownsFd;                   // true when begin() opened fd
+        uint8_t deviceAddress;
+        i2cIoctlFunction i2cIoctl;        // ioctl() entry of the descriptor
+
+        /**
+          Run the messages as one combined transaction
+
+          @param msgs The i2c_msg array
+          @param count Number of messages
+          @return Return DS3231_BUS_OK or the transport status code
+        */
+        uint8_t transfer(struct i2c_msg* msgs, uint8_t count);
+
+      /*-------------------------------
+        Public Function Declaration
+      -------------------------------*/
+      public:
+        /**
+          Create the transport on an i2c-dev node, opened by begin()
+
+          @param device The i2c-dev node e.g. "/dev/i2c-1"
+          @param address The I2C slave address of the DS3231
+          @param ioctlFunction The ioctl() entry of the node, NULL for the system ioctl()
+        */
+        Himadri_DS3231_LinuxTransport(const char* device, uint8_t address, i2cIoctlFunction ioctlFunction = NULL);
+
+        /**
+          Create the transport on an already open i2c-dev file descriptor.
+          The descriptor stays owned by the caller.
+
+          @param descriptor The open file descriptor
+          @param address The I2C slave address of the DS3231
+          @param ioctlFunction The ioctl() entry of the descriptor, NULL for the system ioctl()
+        */
+        Himadri_DS3231_LinuxTransport(int descriptor, uint8_t address, i2cIoctlFunction ioctlFunction = NULL);
+
+        /**
+          Close the i2c-dev node opened by begin(), a descriptor passed in stays open
+        */
+        ~Himadri_DS3231_LinuxTransport() { end(); }
+
+        void begin(void);
+        uint8_t probe(void);
+        uint8_t readRegisters(uint8_t regaddress, uint8_t* buf, uint8_t len);
+        uint8_t writeRegisters(uint8_t regaddress, const uint8_t* buf, uint8_t len);
+
+        /**
+          Close the i2c-dev node opened by begin()
+
+          @return Return void
+        */
+        void end(void);
+
+        /**
+          Returns true when the file descriptor is open
+
+          @return Return boolean
+        */
+        boolean isOpen(void);
+    };
+
+  #endif
+
+#endif
+
+/******************************
+   DS3231 RTC Linux Transport
+******************************/
@@ -0,0 +1,219 @@
+/******************************
+     DS3231 RTC TCA9548A Multiplexer
+
+Access to DS3231 chips behind a TCA9548A I2C multiplexer.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+******************************/
+
+#include "Himadri_DS3231_Mux.h"
+
+/*-------------------------------
+  Private Function Definition
+-------------------------------*/
+
+/**
+  Write the channel select register.
+**/
+uint8_t Himadri_DS3231_Mux::writeSelect(uint8_t value, uint8_t channel) {
+  wire->beginTransmission(muxAddress);
+  #if (ARDUINO >= 100)
+    wire->write((byte)value);
+  #else
+    wire->send((byte)value);
+  #endif
+  uint8_t status = wire->endTransmission();
+
+  // A failed write may have changed the channels or not
+  current = status == DS3231_BUS_OK ? channel : DS3231_MUX_UNKNOWN;
+  return status;
+};
+
+/*-------------------------------
+  Public Function Definition
+-------------------------------*/
+
+/**
+  Create the mux on a TwoWire bus.
+**/
+Himadri_DS3231_Mux::Himadri_DS3231_Mux(TwoWire& bus, uint8_t address) {
+  wire = &bus;
+  muxAddress = address;
+  current = DS3231_MUX_UNKNOWN;
+};
+
+/**
+  Get the TwoWire bus of the mux.
+**/
+TwoWire& Himadri_DS3231_Mux::bus() {
+  return *wire;
+};
+
+/**
+  Open one channel.
+**/
+uint8_t Himadri_DS3231_Mux::select(uint8_t channel) {
+  if(channel >= DS3231_MUX_CHANNELS) {
+    return DS3231_BUS_ERROR;
+  }
+  if(channel == current) {
+    return DS3231_BUS_OK;
+  }
+  return writeSelect(1 << channel, channel);
+};
+
+/**
+  Close every channel.
+**/
+uint8_t Himadri_DS3231_Mux::deselect() {
+  if(current == DS3231_MUX_NONE) {
+    return DS3231_BUS_OK;
+  }
+  return writeSelect(0x00, DS3231_MUX_NONE);
+};
+
+/**
+  Get the channel selected last.
+**/
+uint8_t Himadri_DS3231_Mux::channel() {
+  return current;
+};
+
+/**
+  Forget the selected channel.
+**/
+void Himadri_DS3231_Mux::invalidate() {
+  current = DS3231_MUX_UNKNOWN;
+};
+
+/**
+  Read the epoch of every device of this mux with the fewest channel selects.
+**/
+uint8_t Himadri_DS3231_Mux::poll(Himadri_DS3231_MuxDevice* const* devices, uint8_t count, uint32_t* epochs) {
+  uint8_t first = current;
+  uint8_t read = 0;
+
+  for(uint8_t i = 0; i < count; i++) {
+    epochs[i] = 0;
+  }
+
+  // Pass 0 is the channel already selected, then every other channel once
+  for(uint8_t pass = 0; pass <= DS3231_MUX_CHANNELS; pass++) {
+    uint8_t channel = pass == 0 ? first : pass - 1;
+    if(pass > 0 && channel == first) {
+      continue;
+    }
+    for(uint8_t i = 0; i < count; i++) {
+      if(&devices[i]->owner() != this || devices[i]->channel() != channel) {
+        continue;
+      }
+      if(devices[i]->rtc.readEpoch(&epochs[i]) == true) {
+        read++;
+      } else {
+        epochs[i] = 0;
+      }
+    }
+  }
+  return read;
+};
+
+/**
+  Create the device on a channel of the mux.
+**/
+Himadri_DS3231_MuxDevice::Himadri_DS3231_MuxDevice(Himadri_DS3231_Mux& mux, uint8_t channel, uint8_t address) :
+  rtc(*this) {
+  device = NULL;
+  this->mux = &mux;
+  muxChannel = channel;
+  deviceAddress = address;
+};
+
+/**
+  Create the device on a channel of the mux reaching the chip through another transport.
+**/
+Himadri_DS3231_MuxDevice::Himadri_DS3231_MuxDevice(Himadri_DS3231_Mux& mux, uint8_t channel, Himadri_DS3231_Transport& transport) :
+  rtc(*this) {
+  device = &transport;
+  this->mux = &mux;
+  muxChannel = channel;
+  deviceAddress = DS3231_ADDRESS;
+};
+
+/**
+  Get the channel of the device.
+**/
+uint8_t Himadri_DS3231_MuxDevice::channel() {
+  return muxChannel;
+};
+
+/**
+  Get the mux of the device.
+**/
+Himadri_DS3231_Mux& Himadri_DS3231_MuxDevice::owner() {
+  return *mux;
+};
+
+/**
+  Initialize the bus.
+**/
+void Himadri_DS3231_MuxDevice::begin() {
+  if(device != NULL) {
+    device->begin();
+  } else {
+    mux->bus().begin();
+  }
+};
+
+/**
+  Select the channel and address the device without data.
+**/
+uint8_t Himadri_DS3231_MuxDevice::probe() {
+  uint8_t status = mux->select(muxChannel);
+  if(status != DS3231_BUS_OK) {
+    return status;
+  }
+  if(device == NULL) {
+    return Himadri_DS3231_WireTransport::probe(mux->bus(), deviceAddress);
+  }
+  return device->probe();
+};
+
+/**
+  Select the channel and read consecutive registers in a single transaction.
+**/
+uint8_t Himadri_DS3231_MuxDevice::readRegisters(uint8_t regaddress, uint8_t* buf, uint8_t len) {
+  uint8_t status = mux->select(muxChannel);
+  if(status != DS3231_BUS_OK) {
+    return status;
+  }
+  if(device == NULL) {
+    return Himadri_DS3231_WireTransport::readRegisters(mux->bus(), deviceAddress, regaddress, buf, len);
+  }
+  return device->readRegisters(regaddress, buf, len);
+};
+
+/**
+  Select the channel and write consecutive registers in a single transaction.
+**/
+uint8_t Himadri_DS3231_MuxDevice::writeRegisters(uint8_t regaddress, const uint8_t* buf, uint8_t len) {
+  uint8_t status = mux->select(muxChannel);
+  if(status != DS3231_BUS_OK) {
+    return status;
+  }
+  if(device == NULL) {
+    return Himadri_DS3231_WireTransport::writeRegisters(mux->bus(), deviceAddress, regaddress, buf, len);
+  }
+  return device->writeRegisters(regaddress, buf, len);
+};
+
+/*-------------------------------
+  Public Function Definition
+-------------------------------*/
+
+/******************************
+     DS3231 RTC TCA9548A Multiplexer
+******************************/
@@ -0,0 +1,202 @@
+/******************************
+     DS3231 RTC TCA9548A Multiplexer
+
+Access to DS3231 chips behind a TCA9548A I2C multiplexer. Every DS3231
+answers at 0x68, so a fleet of them is spread over the eight channels of
+one or more muxes. The mux keeps the channel it selected last and a device
+only writes the channel select register when another channel is needed.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+This class implements the following features:
+  1. Channel select skipped when the channel is already selected
+  2. Device handle carrying its own driver, usable as a transport
+  3. Batched poll of the timekeeping registers of N chips starting on the
+     selected channel and selecting every other channel once
+
+  Himadri_DS3231_Mux mux(Wire);
+  Himadri_DS3231_MuxDevice rig0(mux, 0);
+  Himadri_DS3231_MuxDevice rig1(mux, 1);
+
+  rig0.rtc.readEpoch(&epoch);
+
+When several muxes share a bus only one of them may have a channel open,
+the others are closed with deselect().
+
+******************************/
+
+/**
+    Himadri_DS3231_Mux.h
+    Purpose: Header file for Himadri_DS3231_Mux.cpp. Contains the all function declaration.
+*/
+
+#ifndef HIMADRI_DS3231_MUX_H
+
+  #define HIMADRI_DS3231_MUX_H
+
+  #include "Himadri_DS3231.h"
+
+  /*-------------------------------
+     TCA9548A Default I2C Address
+  -------------------------------*/
+  #define DS3231_MUX_ADDRESS          0x70
+  /*-------------------------------
+     TCA9548A Default I2C Address
+  -------------------------------*/
+
+  /*-------------------------------
+      TCA9548A Channel Values
+  -------------------------------*/
+  #define DS3231_MUX_CHANNELS         8
+  #define DS3231_MUX_NONE             0xFE    // every channel closed
+  #define DS3231_MUX_UNKNOWN          0xFF    // selected channel not known
+  /*-------------------------------
+      TCA9548A Channel Values
+  -------------------------------*/
+
+  class Himadri_DS3231_MuxDevice;
+
+  class Himadri_DS3231_Mux {
+    /*-------------------------------
+      Private Function Declaration
+    -------------------------------*/
+    private:
+      TwoWire* wire;
+      uint8_t muxAddress;
+      uint8_t current;                    // channel selected last, DS3231_MUX_NONE / DS3231_MUX_UNKNOWN
+
+      /**
+        Write the channel select register, the cache is unknown on error
+
+        @param value Bit mask of the open channels
+        @param channel The channel cached on success
+        @return Return DS3231_BUS_OK or the transport status code
+      */
+      uint8_t writeSelect(uint8_t value, uint8_t channel);
+
+    /*-------------------------------
+      Public Function Declaration
+    -------------------------------*/
+    public:
+      /**
+        Create the mux on a TwoWire bus
+
+        @param bus The TwoWire bus the TCA9548A is connected to
+        @param address The I2C slave address of the TCA9548A, 0x70 - 0x77
+      */
+      Himadri_DS3231_Mux(TwoWire& bus, uint8_t address = DS3231_MUX_ADDRESS);
+
+      /**
+        Get the TwoWire bus of the mux
+
+        @return Return the TwoWire bus
+      */
+      TwoWire& bus(void);
+
+      /**
+        Open one channel, without I2C traffic when it is already selected
+
+        @param channel The channel 0 - 7
+        @return Return DS3231_BUS_OK or the transport status code
+      */
+      uint8_t select(uint8_t channel);
+
+      /**
+        Close every channel
+
+        @return Return DS3231_BUS_OK or the transport status code
+      */
+      uint8_t deselect(void);
+
+      /**
+        Get the channel selected last
+
+        @return Return the channel 0 - 7, DS3231_MUX_NONE or DS3231_MUX_UNKNOWN
+      */
+      uint8_t channel(void);
+
+      /**
+        Forget the selected channel so the next select writes it. Call it
+        when the mux was reset or written by something else.
+
+        @return Return void
+      */
+      void invalidate(void);
+
+      /**
+        Read the epoch of every device of this mux. The devices of the
+        selected channel are read first and every other channel is selected
+        once, in channel order, whatever the order of the array.
+
+        @param devices The devices to read
+        @param count Number of devices
+        @param epochs Receives the epoch of every device, 0 when it could not be read
+        @return Return the number of devices read
+      */
+      uint8_t poll(Himadri_DS3231_MuxDevice* const* devices, uint8_t count, uint32_t* epochs);
+  };
+
+  class Himadri_DS3231_MuxDevice : public Himadri_DS3231_Transport {
+    /*-------------------------------
+      Private Function Declaration
+    -------------------------------*/
+    private:
+      Himadri_DS3231_Transport* device;           // transport reaching the chip once selected, NULL on the bus of the mux
+      Himadri_DS3231_Mux* mux;
+      uint8_t muxChannel;
+      uint8_t deviceAddress;                      // I2C slave address on the bus of the mux
+
+    /*-------------------------------
+      Public Function Declaration
+    -------------------------------*/
+    public:
+      Himadri_DS3231 rtc;                 // driver of the chip, every access selects the channel
+
+      /**
+        Create the device on a channel of the mux
+
+        @param mux The mux the chip is connected to
+        @param channel The channel 0 - 7
+        @param address The I2C slave address of the DS3231
+      */
+      Himadri_DS3231_MuxDevice(Himadri_DS3231_Mux& mux, uint8_t channel, uint8_t address = DS3231_ADDRESS);
+
+      /**
+        Create the device on a channel of the mux, reaching the chip
+        through another transport once the channel is selected, e.g. the
+        simulator
+
+        @param mux The mux the chip is connected to
+        @param channel The channel 0 - 7
+        @param transport The transport carrying the register accesses
+      */
+      Himadri_DS3231_MuxDevice(Himadri_DS3231_Mux& mux, uint8_t channel, Himadri_DS3231_Transport& transport);
+
+      /**
+        Get the channel of the device
+
+        @return Return the channel 0 - 7
+      */
+      uint8_t channel(void);
+
+      /**
+        Get the mux of the device
+
+        @return Return the mux
+      */
+      Himadri_DS3231_Mux& owner(void);
+
+      void begin(void);
+      uint8_t probe(void);
+      uint8_t readRegisters(uint8_t regaddress, uint8_t* buf, uint8_t len);
+      uint8_t writeRegisters(uint8_t regaddress, const uint8_t* buf, uint8_t len);
+  };
+
+#endif
+
+/******************************
+     DS3231 RTC TCA9548A Multiplexer
+******************************/
@@ -0,0 +1,170 @@
+/******************************
+      DS3231 RTC SQW Ticks
+
+Interrupt driven tick counter on the INT/SQW pin of the DS3231.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+******************************/
+
+#include "Himadri_DS3231_SQW.h"
+
+volatile uint32_t Himadri_DS3231_SQW::tickCount = 0;
+volatile unsigned long Himadri_DS3231_SQW::edgeMicros = 0;
+
+/*-------------------------------
+  Private Function Definition
+-------------------------------*/
+
+/**
+  Interrupt handler counting the falling edges.
+**/
+void Himadri_DS3231_SQW::isr() {
+  edgeMicros = micros();
+  tickCount++;
+};
+
+/*-------------------------------
+  Public Function Definition
+-------------------------------*/
+
+/**
+  Create the tick counter for a DS3231.
+**/
+Himadri_DS3231_SQW::Himadri_DS3231_SQW(Himadri_DS3231& ds3231) {
+  rtc = &ds3231;
+  intPin = 0xFF;
+  shift = 0;
+  baseEpoch = 0;
+  baseTicks = 0;
+  stampsSynced = false;
+};
+
+/**
+  Select the square wave frequency and attach the interrupt.
+**/
+boolean Himadri_DS3231_SQW::begin(uint8_t pin, uint8_t freq) {
+  // 1Hz, 1024Hz = 2^10, 4096Hz = 2^12, 8192Hz = 2^13
+  static const uint8_t shifts[4] = { 0, 10, 12, 13 };
+
+  if(rtc->setSQWFrequency(freq) == false) {
+    return false;
+  }
+  shift = shifts[freq - 1];
+  stampsSynced = false;
+
+  end();
+  intPin = pin;
+  pinMode(intPin, INPUT_PULLUP);
+  noInterrupts();
+  tickCount = 0;
+  interrupts();
+  attachInterrupt(digitalPinToInterrupt(intPin), isr, FALLING);
+
+  return true;
+};
+
+/**
+  Detach the interrupt.
+**/
+void Himadri_DS3231_SQW::end() {
+  if(intPin != 0xFF) {
+    detachInterrupt(digitalPinToInterrupt(intPin));
+    intPin = 0xFF;
+  }
+};
+
+/**
+  Get the number of square wave periods since begin.
+**/
+uint32_t Himadri_DS3231_SQW::ticks() {
+  // 32 bit reads are not atomic on 8 bit controllers
+  noInterrupts();
+  uint32_t count = tickCount;
+  interrupts();
+  return count;
+};
+
+/**
+  Get the square wave frequency.
+**/
+uint16_t Himadri_DS3231_SQW::frequency() {
+  return (uint16_t)1 << shift;
+};
+
+/**
+  Get the milliseconds elapsed since a tick count.
+**/
+uint32_t Himadri_DS3231_SQW::millisSince(uint32_t since) {
+  uint32_t elapsed = ticks() - since;
+  uint32_t mask = ((uint32_t)1 << shift) - 1;
+
+  // Whole seconds and the remaining fraction, both with shifts only
+  return (elapsed >> shift) * 1000UL + (((elapsed & mask) * 1000UL) >> shift);
+};
+
+/**
+  Start the 1Hz square wave and read the RTC second once.
+**/
+boolean Himadri_DS3231_SQW::beginTimestamps(uint8_t pin) {
+  uint32_t before, after, epoch;
+
+  if(begin(pin, SQW1Hz) == false) {
+    return false;
+  }
+
+  // The falling edge of the 1Hz output is the seconds rollover, so the
+  // second read between two equal tick counts belongs to that count
+  do {
+    before = ticks();
+    if(rtc->readEpoch(&epoch) == false) {
+      return false;
+    }
+    after = ticks();
+  } while(before != after);
+
+  baseEpoch = epoch;
+  baseTicks = before;
+  stampsSynced = true;
+  return true;
+};
+
+/**
+  Get the current time with microsecond resolution.
+**/
+boolean Himadri_DS3231_SQW::timestamp(uint32_t* epoch, uint32_t* micro) {
+  uint32_t count;
+  unsigned long edge, now;
+
+  if(stampsSynced == false) {
+    return false;
+  }
+
+  // Retry until no edge arrived while reading, instead of disabling interrupts
+  do {
+    count = tickCount;
+    edge = edgeMicros;
+    now = micros();
+  } while(count != tickCount);
+
+  if(count == baseTicks) {
+    return false;                       // no edge latched yet
+  }
+
+  uint32_t elapsed = (uint32_t)(now - edge);
+  *epoch = baseEpoch + (count - baseTicks);
+  // An edge pending while reading leaves the elapsed time just above a second
+  while(elapsed >= 1000000UL) {
+    elapsed -= 1000000UL;
+    *epoch = *epoch + 1;
+  }
+  *micro = elapsed;
+  return true;
+};
+
+/******************************
+      DS3231 RTC SQW Ticks
+******************************/
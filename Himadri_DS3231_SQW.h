@@ -0,0 +1,133 @@
+/******************************
+      DS3231 RTC SQW Ticks
+
+Interrupt driven tick counter on the INT/SQW pin of the DS3231. The
+square wave gives a precise timebase without any I2C traffic.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+This class implements the following features:
+  1. Select 1Hz / 1.024kHz / 4.096kHz / 8.192kHz square wave and count
+     its falling edges in an interrupt
+  2. Read the tick count and the elapsed milliseconds
+  3. Microsecond timestamps from the 1Hz edge latched with micros() and
+     the RTC second, without I2C traffic per event
+
+Only one instance can be active at a time because the interrupt handler
+has no context.
+
+******************************/
+
+/**
+    Himadri_DS3231_SQW.h
+    Purpose: Header file for Himadri_DS3231_SQW.cpp. Contains the all function declaration.
+*/
+
+#ifndef HIMADRI_DS3231_SQW_H
+
+  #define HIMADRI_DS3231_SQW_H
+
+  #include "Himadri_DS3231.h"
+
+  class Himadri_DS3231_SQW {
+    /*-------------------------------
+      Private Function Declaration
+    -------------------------------*/
+    private:
+      Himadri_DS3231* rtc;
+      uint8_t intPin;                     // pin wired to INT/SQW
+      uint8_t shift;                      // log2 of the frequency
+      uint32_t baseEpoch;                 // RTC second while the tick count was baseTicks
+      uint32_t baseTicks;
+      boolean stampsSynced;
+
+      static volatile uint32_t tickCount;
+      static volatile unsigned long edgeMicros;   // micros() at the last falling edge
+
+      /**
+        Interrupt handler counting the falling edges
+
+        @return Return void
+      */
+      static void isr(void);
+
+    /*-------------------------------
+      Public Function Declaration
+    -------------------------------*/
+    public:
+      /**
+        Create the tick counter for a DS3231
+
+        @param ds3231 The DS3231 driver used to select the frequency
+      */
+      Himadri_DS3231_SQW(Himadri_DS3231& ds3231);
+
+      /**
+        Select the square wave frequency and attach the interrupt to the
+        pin wired to INT/SQW. The pin is an open drain output so the
+        internal pull-up is enabled.
+
+        @param pin The pin wired to INT/SQW, it must support interrupts
+        @param freq SQW1Hz / SQW1024Hz / SQW4096Hz / SQW8192Hz choice
+        @return Return boolean
+      */
+      boolean begin(uint8_t pin, uint8_t freq = SQW1Hz);
+
+      /**
+        Detach the interrupt
+
+        @return Return void
+      */
+      void end(void);
+
+      /**
+        Get the number of square wave periods since begin
+
+        @return Return 32 bit unsigned integer
+      */
+      uint32_t ticks(void);
+
+      /**
+        Get the square wave frequency
+
+        @return Return the frequency in Hz
+      */
+      uint16_t frequency(void);
+
+      /**
+        Get the milliseconds elapsed since a tick count
+
+        @param since Tick count returned by ticks()
+        @return Return the milliseconds
+      */
+      uint32_t millisSince(uint32_t since);
+
+      /**
+        Start the 1Hz square wave like begin and read the RTC second once
+        to number the following edges
+
+        @param pin The pin wired to INT/SQW, it must support interrupts
+        @return Return boolean
+      */
+      boolean beginTimestamps(uint8_t pin);
+
+      /**
+        Get the current time with microsecond resolution from the cached
+        RTC second and the micros() latched on the last 1Hz edge. It does
+        not disable interrupts and can be called from an interrupt handler.
+
+        @param epoch Pointer reference receiving the Unix epoch seconds
+        @param micro Pointer reference receiving the microseconds 0 - 999999
+        @return Return boolean, false until the first edge after beginTimestamps
+      */
+      boolean timestamp(uint32_t* epoch, uint32_t* micro);
+  };
+
+#endif
+
+/******************************
+      DS3231 RTC SQW Ticks
+******************************/
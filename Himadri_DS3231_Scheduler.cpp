@@ -0,0 +1,249 @@
+/******************************
+     DS3231 RTC Alarm Scheduler
+
+Software scheduler multiplexing many timed jobs onto Alarm1.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+******************************/
+
+#include "Himadri_DS3231_Scheduler.h"
+
+volatile boolean Himadri_DS3231_Scheduler::alarmFired = false;
+
+/*-------------------------------
+  Private Function Definition
+-------------------------------*/
+
+/**
+  Interrupt handler flagging the A1F interrupt.
+**/
+void Himadri_DS3231_Scheduler::isr() {
+  alarmFired = true;
+};
+
+/**
+  Swap two heap entries and their positions.
+**/
+void Himadri_DS3231_Scheduler::swap(uint8_t a, uint8_t b) {
+  uint8_t id = heap[a];
+  heap[a] = heap[b];
+  heap[b] = id;
+  position[heap[a]] = a;
+  position[heap[b]] = b;
+};
+
+/**
+  Move a heap entry up until its parent is earlier.
+**/
+void Himadri_DS3231_Scheduler::siftUp(uint8_t index) {
+  while(index > 0) {
+    uint8_t parent = (index - 1) / 2;
+    if(jobs[heap[parent]].deadline <= jobs[heap[index]].deadline) {
+      break;
+    }
+    swap(index, parent);
+    index = parent;
+  }
+};
+
+/**
+  Move a heap entry down until its children are later.
+**/
+void Himadri_DS3231_Scheduler::siftDown(uint8_t index) {
+  while(true) {
+    uint8_t earliest = index;
+    uint8_t left = 2 * index + 1;
+    uint8_t right = left + 1;
+    if(left < count && jobs[heap[left]].deadline < jobs[heap[earliest]].deadline) {
+      earliest = left;
+    }
+    if(right < count && jobs[heap[right]].deadline < jobs[heap[earliest]].deadline) {
+      earliest = right;
+    }
+    if(earliest == index) {
+      break;
+    }
+    swap(index, earliest);
+    index = earliest;
+  }
+};
+
+/**
+  Remove a heap entry.
+**/
+void Himadri_DS3231_Scheduler::removeAt(uint8_t index) {
+  uint8_t id = heap[index];
+  count--;
+  if(index != count) {
+    swap(index, count);
+    siftDown(index);
+    siftUp(index);
+  }
+  position[id] = 0xFF;
+};
+
+/**
+  Program the earliest deadline into Alarm1 if it changed.
+**/
+boolean Himadri_DS3231_Scheduler::arm() {
+  uint32_t now;
+
+  if(count == 0) {
+    return true;
+  }
+  uint32_t deadline = jobs[heap[0]].deadline;
+  if(armed == true && armedDeadline == deadline) {
+    return true;
+  }
+  if(rtc->setAlarmEpoch(deadline, timeFormat) == false) {
+    return false;
+  }
+  armed = true;
+  armedDeadline = deadline;
+
+  // Alarm1 only matches in the future, a deadline already reached would wait for next month
+  if(rtc->readEpoch(&now) == true && now >= deadline) {
+    alarmFired = true;
+  }
+  return true;
+};
+
+/*-------------------------------
+  Public Function Definition
+-------------------------------*/
+
+/**
+  Create the scheduler for a DS3231.
+**/
+Himadri_DS3231_Scheduler::Himadri_DS3231_Scheduler(Himadri_DS3231& ds3231) {
+  rtc = &ds3231;
+  count = 0;
+  armed = false;
+  armedDeadline = 0;
+  intPin = 0xFF;
+  timeFormat = TwentyFourHrFormat;
+  for(uint8_t i = 0; i < DS3231_SCHEDULER_JOBS; i++) {
+    position[i] = 0xFF;
+  }
+};
+
+/**
+  Enable Alarm1 on the INT pin and attach the interrupt.
+**/
+boolean Himadri_DS3231_Scheduler::begin(uint8_t pin, uint8_t timeFormat) {
+  this->timeFormat = timeFormat;
+  rtc->clearINTStatus(Alarm1);
+  rtc->enableAlarm(Alarm1);
+
+  intPin = pin;
+  pinMode(intPin, INPUT_PULLUP);
+  attachInterrupt(digitalPinToInterrupt(intPin), isr, FALLING);
+
+  return arm();
+};
+
+/**
+  Add a job.
+**/
+int8_t Himadri_DS3231_Scheduler::schedule(uint32_t deadline, void (*callback)(uint8_t id), uint32_t period) {
+  uint8_t id;
+
+  for(id = 0; id < DS3231_SCHEDULER_JOBS; id++) {
+    if(position[id] == 0xFF) {
+      break;
+    }
+  }
+  if(id == DS3231_SCHEDULER_JOBS || callback == NULL) {
+    return -1;
+  }
+
+  jobs[id].deadline = deadline;
+  jobs[id].period = period;
+  jobs[id].callback = callback;
+  heap[count] = id;
+  position[id] = count;
+  count++;
+  siftUp(position[id]);
+
+  arm();
+  return id;
+};
+
+/**
+  Remove a pending job.
+**/
+boolean Himadri_DS3231_Scheduler::cancel(uint8_t id) {
+  if(id >= DS3231_SCHEDULER_JOBS || position[id] == 0xFF) {
+    return false;
+  }
+  removeAt(position[id]);
+
+  // A later alarm is left armed, it only causes one empty service call
+  arm();
+  return true;
+};
+
+/**
+  Get the number of pending jobs.
+**/
+uint8_t Himadri_DS3231_Scheduler::pending() {
+  return count;
+};
+
+/**
+  Get the earliest deadline.
+**/
+uint32_t Himadri_DS3231_Scheduler::nextDeadline() {
+  if(count == 0) {
+    return 0;
+  }
+  return jobs[heap[0]].deadline;
+};
+
+/**
+  Run the due jobs after the Alarm1 interrupt.
+**/
+uint8_t Himadri_DS3231_Scheduler::service(boolean force) {
+  uint32_t now;
+  uint8_t ran = 0;
+
+  if(alarmFired == false && force == false) {
+    return 0;
+  }
+  alarmFired = false;
+
+  rtc->clearINTStatus(Alarm1);
+  if(rtc->readEpoch(&now) == false) {
+    return 0;
+  }
+
+  while(count > 0 && jobs[heap[0]].deadline <= now) {
+    uint8_t id = heap[0];
+    void (*callback)(uint8_t id) = jobs[id].callback;
+
+    if(jobs[id].period != 0) {
+      // Skip the periods missed while sleeping
+      do {
+        jobs[id].deadline += jobs[id].period;
+      } while(jobs[id].deadline <= now);
+      siftDown(0);
+    } else {
+      removeAt(0);
+    }
+
+    callback(id);
+    ran++;
+  }
+
+  armed = false;
+  arm();
+  return ran;
+};
+
+/******************************
+     DS3231 RTC Alarm Scheduler
+******************************/
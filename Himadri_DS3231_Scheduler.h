@@ -0,0 +1,185 @@
+/******************************
+     DS3231 RTC Alarm Scheduler
+
+Software scheduler multiplexing many timed jobs onto Alarm1. Pending
+deadlines are kept in a min-heap and only the earliest one is programmed
+into the chip, so the controller can sleep until the INT pin wakes it.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+This class implements the following features:
+  1. One shot and periodic jobs with seconds precision
+  2. Cancel pending jobs
+  3. Alarm1 holds the earliest deadline, written in one burst only when
+     it changes
+  4. Re-arm on the A1F interrupt and run every due job from the main loop
+
+Only one instance can be attached to the INT pin at a time because the
+interrupt handler has no context.
+
+******************************/
+
+/**
+    Himadri_DS3231_Scheduler.h
+    Purpose: Header file for Himadri_DS3231_Scheduler.cpp. Contains the all function declaration.
+*/
+
+#ifndef HIMADRI_DS3231_SCHEDULER_H
+
+  #define HIMADRI_DS3231_SCHEDULER_H
+
+  #include "Himadri_DS3231.h"
+
+  /*-------------------------------
+      Maximum Number Of Jobs
+  -------------------------------*/
+  #ifndef DS3231_SCHEDULER_JOBS
+    #define DS3231_SCHEDULER_JOBS     16
+  #endif
+  /*-------------------------------
+      Maximum Number Of Jobs
+  -------------------------------*/
+
+  /*-------------------------------
+          Scheduled Job
+      Structure Declaration
+  -------------------------------*/
+  struct jobParameters {
+    uint32_t deadline;              // Unix epoch seconds of the next run
+    uint32_t period;                // seconds between runs, 0 for one shot
+    void (*callback)(uint8_t id);   // function called with the job id
+  };
+
+  class Himadri_DS3231_Scheduler {
+    /*-------------------------------
+      Private Function Declaration
+    -------------------------------*/
+    private:
+      Himadri_DS3231* rtc;
+      struct jobParameters jobs[DS3231_SCHEDULER_JOBS];
+      uint8_t heap[DS3231_SCHEDULER_JOBS];      // job ids ordered by deadline
+      uint8_t position[DS3231_SCHEDULER_JOBS];  // heap index of every job id, 0xFF when free
+      uint8_t count;
+      uint32_t armedDeadline;                   // deadline programmed into Alarm1
+      boolean armed;
+      uint8_t intPin;
+      uint8_t timeFormat;                       // hour format of the chip, used by arm()
+
+      static volatile boolean alarmFired;
+
+      /**
+        Interrupt handler flagging the A1F interrupt
+
+        @return Return void
+      */
+      static void isr(void);
+
+      /**
+        Swap two heap entries and their positions
+
+        @return Return void
+      */
+      void swap(uint8_t a, uint8_t b);
+
+      /**
+        Move a heap entry up until its parent is earlier
+
+        @return Return void
+      */
+      void siftUp(uint8_t index);
+
+      /**
+        Move a heap entry down until its children are later
+
+        @return Return void
+      */
+      void siftDown(uint8_t index);
+
+      /**
+        Remove a heap entry
+
+        @return Return void
+      */
+      void removeAt(uint8_t index);
+
+      /**
+        Program the earliest deadline into Alarm1 if it changed. A deadline
+        that passed while writing is flagged for the next service call.
+
+        @return Return boolean
+      */
+      boolean arm(void);
+
+    /*-------------------------------
+      Public Function Declaration
+    -------------------------------*/
+    public:
+      /**
+        Create the scheduler for a DS3231
+
+        @param ds3231 The DS3231 driver whose Alarm1 is used
+      */
+      Himadri_DS3231_Scheduler(Himadri_DS3231& ds3231);
+
+      /**
+        Enable Alarm1 on the INT pin and attach the interrupt to the pin
+        wired to INT/SQW
+
+        @param pin The pin wired to INT/SQW, it must support interrupts
+        @param timeFormat The TwelveHrFormat / TwentyFourHrFormat option parameter of the chip
+        @return Return boolean
+      */
+      boolean begin(uint8_t pin, uint8_t timeFormat = TwentyFourHrFormat);
+
+      /**
+        Add a job
+
+        @param deadline Unix epoch seconds of the first run
+        @param callback Function called with the job id
+        @param period Seconds between runs, 0 for one shot
+        @return Return the job id, -1 when all slots are used
+      */
+      int8_t schedule(uint32_t deadline, void (*callback)(uint8_t id), uint32_t period = 0);
+
+      /**
+        Remove a pending job
+
+        @param id Job id returned by schedule
+        @return Return boolean
+      */
+      boolean cancel(uint8_t id);
+
+      /**
+        Get the number of pending jobs
+
+        @return Return unsigned integer
+      */
+      uint8_t pending(void);
+
+      /**
+        Get the earliest deadline
+
+        @return Return Unix epoch seconds, 0 when there is no job
+      */
+      uint32_t nextDeadline(void);
+
+      /**
+        Run the due jobs after the Alarm1 interrupt, clear A1F and program
+        the next deadline. Without a pending interrupt it returns at once
+        without bus traffic, so it can be called on every pass of the
+        main loop.
+
+        @param force True to check the deadlines without an interrupt
+        @return Return the number of jobs run
+      */
+      uint8_t service(boolean force = false);
+  };
+
+#endif
+
+/******************************
+     DS3231 RTC Alarm Scheduler
+******************************/
@@ -0,0 +1,594 @@
+/******************************
+     DS3231 RTC Simulator
+
+In-memory model of the DS3231 register file (0x00 - 0x12) exposing the
+same interface as the Arduino TwoWire class.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+******************************/
+
+#include "Himadri_DS3231_Sim.h"
+#include "Himadri_DS3231.h"
+
+/*-------------------------------
+    Register Bits Of The Model
+-------------------------------*/
+#define SIM_CTRL_A1IE               0x01    // 00000001
+#define SIM_CTRL_A2IE               0x02    // 00000010
+#define SIM_CTRL_INTCN              0x04    // 00000100
+#define SIM_CTRL_CONV               0x20    // 00100000
+#define SIM_CTRL_BBSQW              0x40    // 01000000
+#define SIM_CTRL_EOSC               0x80    // 10000000
+#define SIM_STAT_A1F                0x01    // 00000001
+#define SIM_STAT_A2F                0x02    // 00000010
+#define SIM_STAT_BSY                0x04    // 00000100
+#define SIM_STAT_EN32KHZ            0x08    // 00001000
+#define SIM_STAT_OSF                0x80    // 10000000
+/*-------------------------------
+    Register Bits Of The Model
+-------------------------------*/
+
+/**
+  Returns BCD to Decimal.
+**/
+static uint8_t simBcd2dec(uint8_t value) {
+  return (value >> 4) * 10 + (value & 0x0F);
+}
+
+/**
+  Returns Decimal to BCD.
+**/
+static uint8_t simDec2bcd(uint8_t value) {
+  return ((value / 10) << 4) | (value % 10);
+}
+
+/**
+  Returns the hour register decoded to 0 - 23.
+**/
+static uint8_t simHour24(uint8_t value) {
+  if((value & 0x40) >> 6 == 1) {                   // 01000000
+    uint8_t hh = simBcd2dec(value & 0x1F) % 12;    // 00011111
+    if((value & 0x20) >> 5 == 1) {                 // 00100000
+      hh += 12;
+    }
+    return hh;
+  }
+  return simBcd2dec(value & 0x3F);                 // 00111111
+}
+
+/*-------------------------------
+  Private Function Definition
+-------------------------------*/
+
+/**
+  Advance the model to the current micros() value.
+**/
+void Himadri_DS3231_Sim::update() {
+  uint32_t now = micros();
+  uint32_t elapsed = now - lastMicros;
+  lastMicros = now;
+
+  if(converting && (uint32_t)(now - convStart) >= convTime) {
+    converting = false;
+    latchTemperature();
+    regs[DS3231_CONTROL_REG] &= ~SIM_CTRL_CONV;
+    regs[DS3231_STATUS_REG] &= ~SIM_STAT_BSY;
+  }
+
+  if(!oscillatorRunning()) {
+    regs[DS3231_STATUS_REG] |= SIM_STAT_OSF;
+    return;
+  }
+
+  subSecond += elapsed;
+  while(subSecond >= 1000000UL) {
+    subSecond -= 1000000UL;
+    tick();
+  }
+}
+
+/**
+  Advance the timekeeping registers by one second and match the alarms.
+**/
+void Himadri_DS3231_Sim::tick() {
+  uint8_t ss = simBcd2dec(regs[DS3231_SECONDS_REG]);
+  if(++ss < 60) {
+    regs[DS3231_SECONDS_REG] = simDec2bcd(ss);
+    matchAlarms();
+    return;
+  }
+  regs[DS3231_SECONDS_REG] = 0;
+
+  uint8_t mm = simBcd2dec(regs[DS3231_MINUTES_REG]);
+  if(++mm < 60) {
+    regs[DS3231_MINUTES_REG] = simDec2bcd(mm);
+    matchAlarms();
+    return;
+  }
+  regs[DS3231_MINUTES_REG] = 0;
+
+  uint8_t hourReg = regs[DS3231_HOUR_REG];
+  boolean newDay = false;
+  if((hourReg & 0x40) >> 6 == 1) {                 // 12Hr format
+    uint8_t hh = simBcd2dec(hourReg & 0x1F);
+    uint8_t pm = hourReg & 0x20;
+    if(hh == 11) {
+      // 11 -> 12 flips the meridian, 11PM -> 12AM starts a new day
+      newDay = (pm != 0);
+      pm ^= 0x20;
+      hh = 12;
+    } else if(hh == 12) {
+      hh = 1;
+    } else {
+      hh++;
+    }
+    regs[DS3231_HOUR_REG] = 0x40 | pm | simDec2bcd(hh);
+  } else {
+    uint8_t hh = simBcd2dec(hourReg & 0x3F);
+    if(++hh == 24) {
+      hh = 0;
+      newDay = true;
+    }
+    regs[DS3231_HOUR_REG] = simDec2bcd(hh);
+  }
+
+  if(newDay) {
+    regs[DS3231_DAY_REG] = regs[DS3231_DAY_REG] % 7 + 1;
+
+    uint8_t d = simBcd2dec(regs[DS3231_DATE_REG]);
+    uint8_t m = simBcd2dec(regs[DS3231_MONTH_REG] & 0x1F);
+    uint8_t y = simBcd2dec(regs[DS3231_YEAR_REG]);
+    uint8_t century = regs[DS3231_MONTH_REG] & 0x80;
+    uint8_t dim = (m >= 1 && m <= 12) ? pgm_read_byte(daysInMonth + m - 1) : 31;
+    if(m == 2 && y % 4 == 0) {
+      dim = 29;
+    }
+    if(++d > dim) {
+      d = 1;
+      if(++m > 12) {
+        m = 1;
+        if(++y > 99) {
+          y = 0;
+          century ^= 0x80;
+        }
+      }
+    }
+    regs[DS3231_DATE_REG] = simDec2bcd(d);
+    regs[DS3231_MONTH_REG] = century | simDec2bcd(m);
+    regs[DS3231_YEAR_REG] = simDec2bcd(y);
+  }
+
+  // The chip runs a conversion on its own every 64 seconds
+  if(++autoConvCount >= 64) {
+    autoConvCount = 0;
+    latchTemperature();
+  }
+
+  matchAlarms();
+}
+
+/**
+  Match Alarm1 and Alarm2 against the timekeeping registers.
+**/
+void Himadri_DS3231_Sim::matchAlarms() {
+  uint8_t ss = regs[DS3231_SECONDS_REG];
+  uint8_t mm = regs[DS3231_MINUTES_REG];
+  uint8_t hh = simHour24(regs[DS3231_HOUR_REG]);
+  uint8_t day = regs[DS3231_DAY_REG] & 0x07;
+  uint8_t date = regs[DS3231_DATE_REG] & 0x3F;
+
+  // Alarm1, a field with its mask bit set always matches
+  uint8_t a1s = regs[DS3231_AL1SEC_REG];
+  uint8_t a1m = regs[DS3231_AL1MIN_REG];
+  uint8_t a1h = regs[DS3231_AL1HOUR_REG];
+  uint8_t a1d = regs[DS3231_AL1WDAY_REG];
+  boolean match = ((a1s & 0x80) || (a1s & 0x7F) == ss) &&
+    ((a1m & 0x80) || (a1m & 0x7F) == mm) &&
+    ((a1h & 0x80) || simHour24(a1h & 0x7F) == hh) &&
+    ((a1d & 0x80) || ((a1d & 0x40) ? (a1d & 0x0F) == day : (a1d & 0x3F) == date));
+  if(match) {
+    regs[DS3231_STATUS_REG] |= SIM_STAT_A1F;
+  }
+
+  // Alarm2 has minutes precision and matches when the seconds are 00
+  uint8_t a2m = regs[DS3231_AL2MIN_REG];
+  uint8_t a2h = regs[DS3231_AL2HOUR_REG];
+  uint8_t a2d = regs[DS3231_AL2WDAY_REG];
+  match = ss == 0 &&
+    ((a2m & 0x80) || (a2m & 0x7F) == mm) &&
+    ((a2h & 0x80) || simHour24(a2h & 0x7F) == hh) &&
+    ((a2d & 0x80) || ((a2d & 0x40) ? (a2d & 0x0F) == day : (a2d & 0x3F) == date));
+  if(match) {
+    regs[DS3231_STATUS_REG] |= SIM_STAT_A2F;
+  }
+}
+
+/**
+  Store a byte written by the bus master into the register file.
+**/
+void Himadri_DS3231_Sim::storeRegister(uint8_t regaddress, uint8_t value) {
+  switch(regaddress) {
+    case DS3231_SECONDS_REG:
+      // Writing the seconds resets the countdown chain
+      regs[regaddress] = value & 0x7F;
+      subSecond = 0;
+    break;
+    case DS3231_MINUTES_REG:
+      regs[regaddress] = value & 0x7F;
+    break;
+    case DS3231_HOUR_REG:
+      regs[regaddress] = value & 0x7F;
+    break;
+    case DS3231_DAY_REG:
+      regs[regaddress] = value & 0x07;
+    break;
+    case DS3231_DATE_REG:
+      regs[regaddress] = value & 0x3F;
+    break;
+    case DS3231_MONTH_REG:
+      regs[regaddress] = value & 0x9F;
+    break;
+    case DS3231_CONTROL_REG:
+      // CONV stays set while a conversion is running and starts one otherwise
+      if(converting) {
+        value |= SIM_CTRL_CONV;
+      } else if((value & SIM_CTRL_CONV) != 0) {
+        converting = true;
+        convStart = micros();
+        regs[DS3231_STATUS_REG] |= SIM_STAT_BSY;
+      }
+      regs[regaddress] = value;
+    break;
+    case DS3231_STATUS_REG:
+      // OSF, A2F and A1F can only be cleared, BSY is read only
+      regs[regaddress] = (regs[regaddress] & (value | ~(SIM_STAT_OSF | SIM_STAT_A2F | SIM_STAT_A1F)) &
+        (SIM_STAT_OSF | SIM_STAT_BSY | SIM_STAT_A2F | SIM_STAT_A1F)) | (value & SIM_STAT_EN32KHZ);
+    break;
+    case DS3231_TEMPERATURE_MSG_REG:
+    case DS3231_TEMPERATURE_LSB_REG:
+      // Read only
+    break;
+    default:
+      regs[regaddress] = value;
+    break;
+  }
+}
+
+/**
+  Latch the sensor temperature into the temperature registers.
+**/
+void Himadri_DS3231_Sim::latchTemperature() {
+  regs[DS3231_TEMPERATURE_MSG_REG] = (uint8_t)(sensorTemp >> 2);
+  regs[DS3231_TEMPERATURE_LSB_REG] = (uint8_t)((sensorTemp & 0x03) << 6);
+}
+
+/**
+  Account one bus transaction.
+**/
+void Himadri_DS3231_Sim::account(uint8_t bytes) {
+  // START, address byte and data bytes with ACK bit, STOP
+  uint32_t bits = 9 * (uint32_t)(bytes + 1);
+  if(busHeld) {
+    // Repeated START continues the transaction in place of the STOP
+    busHeld = false;
+  } else {
+    bits += 2;
+    txCount++;
+  }
+  uint32_t micro = (bits * 1000000UL + busClock - 1) / busClock;
+  busTime += micro;
+  if(busDelay) {
+    delayMicroseconds(micro);
+  }
+}
+
+/**
+  Returns true when the oscillator is running.
+**/
+boolean Himadri_DS3231_Sim::oscillatorRunning() {
+  if(oscillatorFault) {
+    return false;
+  }
+  return !(onBattery && (regs[DS3231_CONTROL_REG] & SIM_CTRL_EOSC) != 0);
+}
+
+/*-------------------------------
+  Public Function Definition
+-------------------------------*/
+
+/**
+  Create the model answering on the given I2C address.
+**/
+Himadri_DS3231_Sim::Himadri_DS3231_Sim(uint8_t address) {
+  deviceAddress = address;
+  busClock = 100000UL;
+  busDelay = false;
+  convTime = 125000UL;
+  sensorTemp = 25 * 4;
+  onBattery = false;
+  oscillatorFault = false;
+  txOpen = false;
+  busHeld = false;
+  txLength = 0;
+  rxLength = 0;
+  rxIndex = 0;
+  resetCounters();
+  powerOn();
+}
+
+void Himadri_DS3231_Sim::begin() {
+}
+
+void Himadri_DS3231_Sim::setClock(uint32_t clock) {
+  if(clock != 0) {
+    busClock = clock;
+  }
+}
+
+void Himadri_DS3231_Sim::beginTransmission(uint8_t address) {
+  txAddress = address;
+  txLength = 0;
+  txOpen = true;
+}
+
+void Himadri_DS3231_Sim::beginTransmission(int address) {
+  beginTransmission((uint8_t)address);
+}
+
+size_t Himadri_DS3231_Sim::write(uint8_t data) {
+  if(!txOpen || txLength >= DS3231_SIM_BUFFER_LENGTH) {
+    return 0;
+  }
+  txBuffer[txLength++] = data;
+  return 1;
+}
+
+size_t Himadri_DS3231_Sim::write(const uint8_t* data, size_t quantity) {
+  size_t n = 0;
+  while(n < quantity && write(data[n]) == 1) {
+    n++;
+  }
+  return n;
+}
+
+uint8_t Himadri_DS3231_Sim::endTransmission(uint8_t sendStop) {
+  if(!txOpen) {
+    return 4;
+  }
+  txOpen = false;
+  update();
+  account(txLength);
+  update();                               // the chip keeps counting during the transfer
+  busHeld = !sendStop;
+
+  if(txAddress != deviceAddress) {
+    busHeld = false;
+    nackCount++;
+    return 2;                             // NACK on address
+  }
+
+  txBytes += txLength;
+  if(txLength > 0) {
+    pointer = txBuffer[0] % DS3231_SIM_REGISTERS;
+    for(uint8_t i = 1; i < txLength; i++) {
+      storeRegister(pointer, txBuffer[i]);
+      if(pointer == DS3231_SECONDS_REG && busDelay) {
+        // The countdown chain restarts on the ACK of the seconds byte, the
+        // remaining bytes and the STOP have already been counted
+        subSecond = ((9 * (uint32_t)(txLength - 1 - i) + 1) * 1000000UL) / busClock;
+      }
+      pointer = (pointer + 1) % DS3231_SIM_REGISTERS;
+    }
+  }
+  return 0;
+}
+
+uint8_t Himadri_DS3231_Sim::requestFrom(uint8_t address, uint8_t quantity, uint8_t sendStop) {
+  if(quantity > DS3231_SIM_BUFFER_LENGTH) {
+    quantity = DS3231_SIM_BUFFER_LENGTH;
+  }
+  rxIndex = 0;
+  rxLength = 0;
+  update();
+
+  if(address != deviceAddress) {
+    account(0);
+    busHeld = false;
+    nackCount++;
+    return 0;
+  }
+
+  account(quantity);
+  busHeld = !sendStop;
+  for(uint8_t i = 0; i < quantity; i++) {
+    rxBuffer[i] = regs[pointer];
+    pointer = (pointer + 1) % DS3231_SIM_REGISTERS;
+  }
+  rxLength = quantity;
+  rxBytes += quantity;
+  return quantity;
+}
+
+uint8_t Himadri_DS3231_Sim::requestFrom(int address, int quantity, int sendStop) {
+  return requestFrom((uint8_t)address, (uint8_t)quantity, (uint8_t)sendStop);
+}
+
+int Himadri_DS3231_Sim::available() {
+  return rxLength - rxIndex;
+}
+
+int Himadri_DS3231_Sim::read() {
+  if(rxIndex >= rxLength) {
+    return -1;
+  }
+  return rxBuffer[rxIndex++];
+}
+
+int Himadri_DS3231_Sim::peek() {
+  if(rxIndex >= rxLength) {
+    return -1;
+  }
+  return rxBuffer[rxIndex];
+}
+
+/**
+  Address the model without data.
+**/
+uint8_t Himadri_DS3231_Sim::probe() {
+  beginTransmission(deviceAddress);
+  return endTransmission();
+}
+
+/**
+  Reads consecutive registers with the same transactions as the Wire transport.
+**/
+uint8_t Himadri_DS3231_Sim::readRegisters(uint8_t regaddress, uint8_t* buf, uint8_t len) {
+  beginTransmission(deviceAddress);
+  write(regaddress);
+  uint8_t status = endTransmission();
+  if(status != DS3231_BUS_OK) {
+    return status;
+  }
+  if(requestFrom(deviceAddress, len) != len) {
+    return DS3231_BUS_SHORT_READ;
+  }
+  for(uint8_t i = 0; i < len; i++) {
+    buf[i] = read();
+  }
+  return DS3231_BUS_OK;
+}
+
+/**
+  Writes consecutive registers in a single transaction.
+**/
+uint8_t Himadri_DS3231_Sim::writeRegisters(uint8_t regaddress, const uint8_t* buf, uint8_t len) {
+  beginTransmission(deviceAddress);
+  write(regaddress);
+  if(write(buf, len) != len) {
+    txOpen = false;
+    return DS3231_BUS_TOO_LONG;
+  }
+  return endTransmission();
+}
+
+/**
+  Reset the register file to the power on state. OSF is set.
+**/
+void Himadri_DS3231_Sim::powerOn() {
+  for(uint8_t i = 0; i < DS3231_SIM_REGISTERS; i++) {
+    regs[i] = 0;
+  }
+  regs[DS3231_DAY_REG] = 1;
+  regs[DS3231_DATE_REG] = 1;
+  regs[DS3231_MONTH_REG] = 1;
+  regs[DS3231_CONTROL_REG] = 0x1C;                // 00011100 INTCN, RS2, RS1
+  regs[DS3231_STATUS_REG] = SIM_STAT_OSF | SIM_STAT_EN32KHZ;
+  latchTemperature();
+  pointer = 0;
+  subSecond = 0;
+  converting = false;
+  autoConvCount = 0;
+  lastMicros = micros();
+}
+
+void Himadri_DS3231_Sim::setBatteryPower(boolean battery) {
+  update();
+  onBattery = battery;
+}
+
+void Himadri_DS3231_Sim::setOscillatorFault(boolean fault) {
+  update();
+  oscillatorFault = fault;
+  if(fault) {
+    regs[DS3231_STATUS_REG] |= SIM_STAT_OSF;
+  }
+}
+
+void Himadri_DS3231_Sim::setTemperature(int16_t quarterDegrees) {
+  sensorTemp = quarterDegrees;
+}
+
+void Himadri_DS3231_Sim::setConversionTime(uint32_t micro) {
+  convTime = micro;
+}
+
+void Himadri_DS3231_Sim::simulateBusTime(boolean enable) {
+  busDelay = enable;
+}
+
+uint8_t Himadri_DS3231_Sim::registerValue(uint8_t regaddress) {
+  update();
+  return regs[regaddress % DS3231_SIM_REGISTERS];
+}
+
+void Himadri_DS3231_Sim::setRegisterValue(uint8_t regaddress, uint8_t value) {
+  update();
+  regs[regaddress % DS3231_SIM_REGISTERS] = value;
+}
+
+uint32_t Himadri_DS3231_Sim::subSecondMicros() {
+  update();
+  return subSecond;
+}
+
+/**
+  Get the INT/SQW pin level.
+**/
+uint8_t Himadri_DS3231_Sim::intPin() {
+  update();
+  uint8_t ctReg = regs[DS3231_CONTROL_REG];
+  uint8_t statusReg = regs[DS3231_STATUS_REG];
+
+  if((ctReg & SIM_CTRL_INTCN) != 0) {
+    if(((ctReg & SIM_CTRL_A1IE) && (statusReg & SIM_STAT_A1F)) ||
+      ((ctReg & SIM_CTRL_A2IE) && (statusReg & SIM_STAT_A2F))) {
+      return LOW;
+    }
+    return HIGH;
+  }
+
+  if(!oscillatorRunning() || (onBattery && (ctReg & SIM_CTRL_BBSQW) == 0)) {
+    return HIGH;
+  }
+
+  // RS2 RS1 -> 1Hz / 1.024kHz / 4.096kHz / 8.192kHz, the 1Hz output falls on the second
+  static const uint16_t freq[4] = { 1, 1024, 4096, 8192 };
+  uint32_t halfPeriods = (uint32_t)(((uint64_t)subSecond * freq[(ctReg >> 3) & 0x03] * 2) / 1000000UL);
+  return (halfPeriods & 0x01) ? HIGH : LOW;
+}
+
+uint32_t Himadri_DS3231_Sim::transactions() {
+  return txCount;
+}
+
+uint32_t Himadri_DS3231_Sim::bytesWritten() {
+  return txBytes;
+}
+
+uint32_t Himadri_DS3231_Sim::bytesRead() {
+  return rxBytes;
+}
+
+uint32_t Himadri_DS3231_Sim::nacks() {
+  return nackCount;
+}
+
+uint32_t Himadri_DS3231_Sim::busMicros() {
+  return busTime;
+}
+
+void Himadri_DS3231_Sim::resetCounters() {
+  txCount = 0;
+  txBytes = 0;
+  rxBytes = 0;
+  nackCount = 0;
+  busTime = 0;
+}
+
+/******************************
+     DS3231 RTC Simulator
+******************************/
@@ -0,0 +1,305 @@
+/******************************
+     DS3231 RTC Simulator
+
+In-memory model of the DS3231 register file (0x00 - 0x12) exposing the
+same interface as the Arduino TwoWire class and the driver transport
+interface. It lets the library be exercised and its bus traffic counted
+without a board or a chip.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+The model implements the following behaviour:
+  1. Register pointer with auto increment wrapping from 0x12 to 0x00
+  2. Timekeeping with seconds / minutes / hour / day / date / month / year
+     rollover in 12 and 24 Hour format including leap years and century bit
+  3. Writing the Seconds Register resets the one second countdown chain
+  4. Alarm1 / Alarm2 matching with mask bits and DY/DT, setting A1F / A2F
+  5. A1F / A2F / OSF can only be cleared, BSY is read only
+  6. CONV starts a temperature conversion which keeps CONV and BSY set for
+     the conversion time
+  7. OSF is set at power on and whenever the oscillator is stopped
+  8. INT/SQW pin level for interrupt and square wave mode
+  9. Transaction, byte, NACK and modelled bus time counters, a repeated
+     START continues the transaction
+
+******************************/
+
+/**
+    Himadri_DS3231_Sim.h
+    Purpose: Header file for Himadri_DS3231_Sim.cpp. Contains the all function declaration.
+*/
+
+#ifndef HIMADRI_DS3231_SIM_H
+
+  #define HIMADRI_DS3231_SIM_H
+
+  #if (ARDUINO >= 100)
+    #include <Arduino.h>
+  #else
+    #include <WProgram.h>
+  #endif
+
+  #include "Himadri_DS3231_Transport.h"
+
+  /*-------------------------------
+      Simulator Register Count
+  -------------------------------*/
+  #define DS3231_SIM_REGISTERS        0x13
+  /*-------------------------------
+      Simulator Register Count
+  -------------------------------*/
+
+  /*-------------------------------
+      Simulator Buffer Length
+    Same as the Wire library buffer
+  -------------------------------*/
+  #define DS3231_SIM_BUFFER_LENGTH    32
+  /*-------------------------------
+      Simulator Buffer Length
+    Same as the Wire library buffer
+  -------------------------------*/
+
+  class Himadri_DS3231_Sim : public Himadri_DS3231_Transport {
+    /*-------------------------------
+      Private Function Declaration
+    -------------------------------*/
+    private:
+      uint8_t regs[DS3231_SIM_REGISTERS];       // register file
+      uint8_t deviceAddress;                    // I2C slave address answered by the model
+      uint8_t pointer;                          // register pointer
+
+      uint8_t txAddress;                        // address of the open transmission
+      uint8_t txBuffer[DS3231_SIM_BUFFER_LENGTH];
+      uint8_t txLength;
+      boolean txOpen;
+      boolean busHeld;                          // last transaction ended without STOP
+
+      uint8_t rxBuffer[DS3231_SIM_BUFFER_LENGTH];
+      uint8_t rxLength;
+      uint8_t rxIndex;
+
+      uint32_t lastMicros;                      // micros() at the last update
+      uint32_t subSecond;                       // microseconds into the current second
+      uint32_t convStart;                       // micros() when the conversion started
+      uint32_t convTime;                        // conversion time in microseconds
+      boolean converting;
+      uint8_t autoConvCount;                    // seconds since the last automatic conversion
+      int16_t sensorTemp;                       // sensor temperature in quarter degrees
+      boolean onBattery;
+      boolean oscillatorFault;
+
+      uint32_t busClock;                        // bus clock in Hz used for bus time
+      boolean busDelay;                         // spend the modelled bus time in delayMicroseconds
+
+      uint32_t txCount;
+      uint32_t txBytes;
+      uint32_t rxBytes;
+      uint32_t nackCount;
+      uint32_t busTime;
+
+      /**
+        Advance the model to the current micros() value
+
+        @return Return void
+      */
+      void update(void);
+
+      /**
+        Advance the timekeeping registers by one second and match the alarms
+
+        @return Return void
+      */
+      void tick(void);
+
+      /**
+        Match Alarm1 and Alarm2 against the timekeeping registers
+
+        @return Return void
+      */
+      void matchAlarms(void);
+
+      /**
+        Store a byte written by the bus master into the register file
+
+        @param regaddress The address of the register to write
+        @param value 8 bit unsigned integer value to write to register
+        @return Return void
+      */
+      void storeRegister(uint8_t regaddress, uint8_t value);
+
+      /**
+        Latch the sensor temperature into the temperature registers
+
+        @return Return void
+      */
+      void latchTemperature(void);
+
+      /**
+        Account one bus transaction
+
+        @param bytes Number of bytes on the bus excluding the address byte
+        @return Return void
+      */
+      void account(uint8_t bytes);
+
+      /**
+        Returns true when the oscillator is running
+
+        @return Return boolean
+      */
+      boolean oscillatorRunning(void);
+
+    /*-------------------------------
+      Public Function Declaration
+    -------------------------------*/
+    public:
+      /**
+        Create the model answering on the given I2C address
+
+        @param address The I2C slave address of the simulated device
+      */
+      Himadri_DS3231_Sim(uint8_t address = 0x68);
+
+      /*-------------------------------
+           TwoWire Compatible API
+      -------------------------------*/
+      void begin(void);
+      void setClock(uint32_t clock);
+      void beginTransmission(uint8_t address);
+      void beginTransmission(int address);
+      size_t write(uint8_t data);
+      size_t write(const uint8_t* data, size_t quantity);
+      inline size_t write(int n) { return write((uint8_t)n); }
+      inline size_t send(uint8_t data) { return write(data); }
+      uint8_t endTransmission(uint8_t sendStop = true);
+      uint8_t requestFrom(uint8_t address, uint8_t quantity, uint8_t sendStop = true);
+      uint8_t requestFrom(int address, int quantity, int sendStop = 1);
+      int available(void);
+      int read(void);
+      int peek(void);
+      inline uint8_t receive(void) { return (uint8_t)read(); }
+
+      /*-------------------------------
+              Transport API
+      -------------------------------*/
+      uint8_t probe(void);
+      uint8_t readRegisters(uint8_t regaddress, uint8_t* buf, uint8_t len);
+      uint8_t writeRegisters(uint8_t regaddress, const uint8_t* buf, uint8_t len);
+
+      /*-------------------------------
+            Simulation Control
+      -------------------------------*/
+      /**
+        Reset the register file to the power on state. OSF is set.
+
+        @return Return void
+      */
+      void powerOn(void);
+
+      /**
+        Switch the supply between VCC and VBAT. On VBAT the oscillator stops
+        when EOSC is set.
+
+        @param battery True to run from VBAT and false to run from VCC
+        @return Return void
+      */
+      void setBatteryPower(boolean battery);
+
+      /**
+        Stop or restart the oscillator to simulate a crystal fault
+
+        @param fault True to stop the oscillator
+        @return Return void
+      */
+      void setOscillatorFault(boolean fault);
+
+      /**
+        Set the temperature seen by the sensor. It is latched into the
+        temperature registers by the next conversion.
+
+        @param quarterDegrees Temperature in 0.25 degree Celsius steps
+        @return Return void
+      */
+      void setTemperature(int16_t quarterDegrees);
+
+      /**
+        Set the temperature conversion time
+
+        @param micro Conversion time in microseconds
+        @return Return void
+      */
+      void setConversionTime(uint32_t micro);
+
+      /**
+        Spend the modelled bus time of every transaction in delayMicroseconds
+        so that time advances as it would on a real bus
+
+        @param enable True to delay for the bus time
+        @return Return void
+      */
+      void simulateBusTime(boolean enable);
+
+      /**
+        Read a register without a bus transaction
+
+        @param regaddress The address of the register to read
+        @return Return 8 bit unsigned integer from the register address
+      */
+      uint8_t registerValue(uint8_t regaddress);
+
+      /**
+        Write a register without a bus transaction and without the write
+        rules of the bus, used to preload the model
+
+        @param regaddress The address of the register to write
+        @param value 8 bit unsigned integer value to write to register
+        @return Return void
+      */
+      void setRegisterValue(uint8_t regaddress, uint8_t value);
+
+      /**
+        Get the microseconds elapsed in the current second
+
+        @return Return 32 bit unsigned integer
+      */
+      uint32_t subSecondMicros(void);
+
+      /**
+        Get the INT/SQW pin level. It is LOW while an enabled alarm flag is set
+        with INTCN = 1 and follows the square wave with INTCN = 0.
+
+        @return Return HIGH / LOW
+      */
+      uint8_t intPin(void);
+
+      /*-------------------------------
+                Bus Counters
+      -------------------------------*/
+      uint32_t transactions(void);
+      uint32_t bytesWritten(void);
+      uint32_t bytesRead(void);
+      uint32_t nacks(void);
+
+      /**
+        Get the modelled bus time of all transactions
+
+        @return Return the bus time in microseconds
+      */
+      uint32_t busMicros(void);
+
+      /**
+        Reset all bus counters to 0
+
+        @return Return void
+      */
+      void resetCounters(void);
+  };
+
+#endif
+
+/******************************
+     DS3231 RTC Simulator
+******************************/
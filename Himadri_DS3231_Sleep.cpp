@@ -0,0 +1,241 @@
+/******************************
+     DS3231 RTC Sleep Planner
+
+Wake planner for sleeping MCUs on the Alarm1 interrupt.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+******************************/
+
+#include "Himadri_DS3231_Sleep.h"
+
+#if defined(__AVR__)
+  #include <avr/sleep.h>
+#endif
+
+uint8_t Himadri_DS3231_Sleep::intPin = 0xFF;
+volatile boolean Himadri_DS3231_Sleep::woken = false;
+volatile unsigned long Himadri_DS3231_Sleep::wakeMillis = 0;
+
+/*-------------------------------
+  Private Function Definition
+-------------------------------*/
+
+/**
+  Interrupt handler recording the wake edge.
+**/
+void Himadri_DS3231_Sleep::isr() {
+  // millis() stood still in sleep, it resumes counting from this edge
+  wakeMillis = millis();
+  woken = true;
+  // INT stays low until A1F is cleared, a low level interrupt would fire again
+  detachInterrupt(digitalPinToInterrupt(intPin));
+};
+
+/**
+  Read the software clock as the start of the plan.
+**/
+void Himadri_DS3231_Sleep::capture() {
+  planEpoch = clock->now(&planMs);
+  planMillis = millis();
+};
+
+/**
+  Returns true when the wake time is too close to the plan.
+**/
+boolean Himadri_DS3231_Sleep::tooClose(uint32_t epoch) {
+  if(epoch <= planEpoch) {
+    return true;
+  }
+  return epoch - planEpoch == 1 && 1000U - planMs < DS3231_SLEEP_MIN_MS;
+};
+
+/**
+  Returns true when the wake time is beyond the next match of its date.
+**/
+boolean Himadri_DS3231_Sleep::tooFar(uint32_t epoch) {
+  return epoch > planEpoch && epoch - planEpoch > DS3231_SLEEP_MAX_SECONDS;
+};
+
+/**
+  Program Alarm1 and attach the wake interrupt.
+**/
+boolean Himadri_DS3231_Sleep::arm(uint32_t epoch) {
+  if(intPin == 0xFF || rtc->setAlarmEpoch(epoch, timeFormat) == false) {
+    return false;
+  }
+  wakeEpoch = epoch;
+
+  noInterrupts();
+  woken = false;
+  interrupts();
+
+  attachInterrupt(digitalPinToInterrupt(intPin), isr, DS3231_SLEEP_WAKE_MODE);
+  return true;
+};
+
+/*-------------------------------
+  Public Function Definition
+-------------------------------*/
+
+/**
+  Create the planner for a DS3231 and a software clock.
+**/
+Himadri_DS3231_Sleep::Himadri_DS3231_Sleep(Himadri_DS3231& ds3231, Himadri_DS3231_Clock& swClock) {
+  rtc = &ds3231;
+  clock = &swClock;
+  timeFormat = TwentyFourHrFormat;
+  wakeEpoch = 0;
+  planEpoch = 0;
+  planMs = 0;
+  planMillis = 0;
+  slept = 0;
+};
+
+/**
+  Clear A1F, enable the Alarm1 interrupt and set the pin.
+**/
+void Himadri_DS3231_Sleep::begin(uint8_t pin, uint8_t timeFormat) {
+  end();
+  this->timeFormat = timeFormat;
+  rtc->clearINTStatus(Alarm1);
+  rtc->enableAlarm(Alarm1);
+
+  pinMode(pin, INPUT_PULLUP);
+  intPin = pin;
+};
+
+/**
+  Detach the wake interrupt.
+**/
+void Himadri_DS3231_Sleep::end() {
+  if(intPin != 0xFF) {
+    detachInterrupt(digitalPinToInterrupt(intPin));
+    intPin = 0xFF;
+  }
+};
+
+/**
+  Plan the wake on the next multiple of the period.
+**/
+uint32_t Himadri_DS3231_Sleep::planEvery(uint32_t period) {
+  uint32_t epoch;
+
+  if(period == 0) {
+    return 0;
+  }
+  capture();
+
+  epoch = (planEpoch / period + 1) * period;
+  if(tooClose(epoch) == true) {
+    epoch += period;
+  }
+
+  if(tooFar(epoch) == true || arm(epoch) == false) {
+    return 0;
+  }
+  return epoch;
+};
+
+/**
+  Plan the wake at a time.
+**/
+boolean Himadri_DS3231_Sleep::planAt(uint32_t epoch) {
+  capture();
+
+  if(tooClose(epoch) == true || tooFar(epoch) == true) {
+    return false;
+  }
+  return arm(epoch);
+};
+
+/**
+  Sleep until the wake interrupt.
+**/
+void Himadri_DS3231_Sleep::sleep() {
+  if(intPin == 0xFF) {
+    return;
+  }
+#if defined(__AVR__)
+  set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+  noInterrupts();
+  if(woken == false) {
+    sleep_enable();
+    // The instruction after sei always runs, no interrupt is lost before sleep
+    interrupts();
+    sleep_cpu();
+    sleep_disable();
+  }
+  interrupts();
+#else
+  while(woken == false) {
+    delay(1);
+  }
+#endif
+};
+
+/**
+  Get whether the wake interrupt fired since the plan.
+**/
+boolean Himadri_DS3231_Sleep::hasWoken() {
+  return woken;
+};
+
+/**
+  Read the chip once after the wake and move the software clock.
+**/
+boolean Himadri_DS3231_Sleep::wake() {
+  uint32_t epoch, secEpoch;
+  unsigned long t = millis();
+  unsigned long edge, secStart, awake;
+  boolean fired;
+
+  noInterrupts();
+  fired = woken;
+  edge = wakeMillis;
+  interrupts();
+
+  if(rtc->readEpoch(&epoch) == false) {
+    return false;
+  }
+  secEpoch = epoch;
+  secStart = t;
+
+  if(fired == true) {
+    rtc->clearINTStatus(Alarm1);
+
+    // INT fell on the rollover into the wake second, the chip must agree
+    awake = (t - edge) / 1000UL;
+    if(epoch >= wakeEpoch && epoch - wakeEpoch <= awake + 1 && epoch - wakeEpoch + 1 >= awake) {
+      secEpoch = wakeEpoch;
+      secStart = edge;
+    }
+  }
+  clock->setSecondStart(secEpoch, secStart);
+
+  // Time passed since the plan less the time counted by millis()
+  long missed = (long)((secEpoch - planEpoch) * 1000UL - planMs - (secStart - planMillis));
+  slept = missed > 0 ? (unsigned long)missed : 0;
+  return true;
+};
+
+/**
+  Get the milliseconds millis() missed in the last sleep.
+**/
+unsigned long Himadri_DS3231_Sleep::sleptMillis() {
+  return slept;
+};
+
+/**
+  Get the planned wake time.
+**/
+uint32_t Himadri_DS3231_Sleep::wakeTime() {
+  return wakeEpoch;
+};
+
+/******************************
+     DS3231 RTC Sleep Planner
+******************************/
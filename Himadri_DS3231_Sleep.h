@@ -0,0 +1,229 @@
+/******************************
+     DS3231 RTC Sleep Planner
+
+Wake planner for sleeping MCUs. It computes the next wake time from the
+software clock, programs it into Alarm1 with one burst write and attaches
+the wake interrupt on the INT/SQW pin. After the wake one epoch read checks
+the second that started on the interrupt edge and the software clock is
+moved to it, so the time lost while millis() was stopped is recovered.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+This class implements the following features:
+  1. Next wake time on a period grid of the epoch, e.g. every 600 seconds
+     on :00, :10, :20, or on an explicit epoch
+  2. One 4 byte write to program Alarm1, no I2C traffic to plan the time
+     while the software clock is synced
+  3. One epoch read and one Status Register write after the wake
+  4. Milliseconds slept with millis() stopped, to the millisecond when the
+     alarm woke the MCU and to the second otherwise
+  5. Power down sleep until the alarm on AVR
+
+Alarm1 matches the date of the month, so a wake time is only accepted up
+to DS3231_SLEEP_MAX_SECONDS (28 days) ahead. A later one could match the
+same date in an earlier month.
+
+Only one instance can be active at a time because the interrupt handler
+has no context.
+
+******************************/
+
+/**
+    Himadri_DS3231_Sleep.h
+    Purpose: Header file for Himadri_DS3231_Sleep.cpp. Contains the all function declaration.
+*/
+
+#ifndef HIMADRI_DS3231_SLEEP_H
+
+  #define HIMADRI_DS3231_SLEEP_H
+
+  #include "Himadri_DS3231.h"
+  #include "Himadri_DS3231_Clock.h"
+
+  /*-------------------------------
+    Shortest Time To Wake In ms
+  -------------------------------*/
+  #define DS3231_SLEEP_MIN_MS         100U
+  /*-------------------------------
+    Shortest Time To Wake In ms
+  -------------------------------*/
+
+  /*-------------------------------
+  Longest Time To Wake In Seconds
+  -------------------------------*/
+  #define DS3231_SLEEP_MAX_SECONDS    2419200UL   // 28 days, the shortest month
+  /*-------------------------------
+  Longest Time To Wake In Seconds
+  -------------------------------*/
+
+  /*-------------------------------
+     Wake Interrupt Trigger Mode
+  -------------------------------*/
+  #if defined(__AVR__)
+    // INT0 / INT1 wake the ATmega from power down only on the low level
+    #define DS3231_SLEEP_WAKE_MODE    LOW
+  #else
+    #define DS3231_SLEEP_WAKE_MODE    FALLING
+  #endif
+  /*-------------------------------
+     Wake Interrupt Trigger Mode
+  -------------------------------*/
+
+  class Himadri_DS3231_Sleep {
+    /*-------------------------------
+      Private Function Declaration
+    -------------------------------*/
+    private:
+      Himadri_DS3231* rtc;
+      Himadri_DS3231_Clock* clock;
+      uint8_t timeFormat;
+      uint32_t wakeEpoch;                 // epoch programmed into Alarm1
+      uint32_t planEpoch;                 // software clock time of the plan
+      uint16_t planMs;
+      unsigned long planMillis;           // millis() of the plan
+      unsigned long slept;                // milliseconds of the last sleep
+
+      // Written by the interrupt handler, which detaches itself
+      static uint8_t intPin;              // pin wired to INT/SQW
+      static volatile boolean woken;
+      static volatile unsigned long wakeMillis;   // millis() on the interrupt edge
+
+      /**
+        Interrupt handler recording the wake edge
+
+        @return Return void
+      */
+      static void isr(void);
+
+      /**
+        Read the software clock as the start of the plan
+
+        @return Return void
+      */
+      void capture(void);
+
+      /**
+        Returns true when the wake time is too close to the plan to be
+        programmed safely before the match
+
+        @param epoch The wake time as Unix epoch seconds
+        @return Return boolean
+      */
+      boolean tooClose(uint32_t epoch);
+
+      /**
+        Returns true when the wake time is further than DS3231_SLEEP_MAX_SECONDS
+        from the plan, the date match of Alarm1 could fire a month early
+
+        @param epoch The wake time as Unix epoch seconds
+        @return Return boolean
+      */
+      boolean tooFar(uint32_t epoch);
+
+      /**
+        Program Alarm1 and attach the wake interrupt
+
+        @param epoch The wake time as Unix epoch seconds
+        @return Return boolean
+      */
+      boolean arm(uint32_t epoch);
+
+    /*-------------------------------
+      Public Function Declaration
+    -------------------------------*/
+    public:
+      /**
+        Create the planner for a DS3231 and the software clock it keeps
+
+        @param ds3231 The DS3231 driver used to program the alarm
+        @param swClock The software clock advanced after every wake
+      */
+      Himadri_DS3231_Sleep(Himadri_DS3231& ds3231, Himadri_DS3231_Clock& swClock);
+
+      /**
+        Clear A1F, enable the Alarm1 interrupt and set the pin wired to
+        INT/SQW. The pin is an open drain output so the internal pull-up is
+        enabled.
+
+        @param pin The pin wired to INT/SQW, it must support interrupts
+        @param timeFormat The TwelveHrFormat / TwentyFourHrFormat option parameter of the chip
+        @return Return void
+      */
+      void begin(uint8_t pin, uint8_t timeFormat = TwentyFourHrFormat);
+
+      /**
+        Detach the wake interrupt
+
+        @return Return void
+      */
+      void end(void);
+
+      /**
+        Plan the wake on the next multiple of the period. A multiple closer
+        than DS3231_SLEEP_MIN_MS is skipped for the one after it.
+
+        @param period Seconds between two wakes
+        @return Return the wake time as Unix epoch seconds, 0 on failure or
+        when it is further than DS3231_SLEEP_MAX_SECONDS
+      */
+      uint32_t planEvery(uint32_t period);
+
+      /**
+        Plan the wake at a time
+
+        @param epoch The wake time as Unix epoch seconds
+        @return Return boolean, false when it is closer than DS3231_SLEEP_MIN_MS
+        or further than DS3231_SLEEP_MAX_SECONDS
+      */
+      boolean planAt(uint32_t epoch);
+
+      /**
+        Sleep until the wake interrupt. On AVR the MCU is put in power down,
+        elsewhere it only waits, use the sleep call of the platform instead
+        and check hasWoken before it.
+
+        @return Return void
+      */
+      void sleep(void);
+
+      /**
+        Get whether the wake interrupt fired since the plan
+
+        @return Return boolean
+      */
+      boolean hasWoken(void);
+
+      /**
+        Read the chip once after the wake, clear A1F and move the software
+        clock to the second that started on the interrupt edge. Without the
+        edge, e.g. woken by another interrupt, the second read is used and
+        the alarm stays planned.
+
+        @return Return boolean
+      */
+      boolean wake(void);
+
+      /**
+        Get the milliseconds millis() missed in the last sleep, add them to
+        the timers based on millis()
+
+        @return Return unsigned long
+      */
+      unsigned long sleptMillis(void);
+
+      /**
+        Get the planned wake time
+
+        @return Return Unix epoch seconds
+      */
+      uint32_t wakeTime(void);
+  };
+
+#endif
+
+/******************************
+     DS3231 RTC Sleep Planner
+******************************/
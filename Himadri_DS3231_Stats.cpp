@@ -0,0 +1,169 @@
+/******************************
+     DS3231 RTC Instrumentation
+
+Bus counters and latency histograms of the DS3231 driver.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+******************************/
+
+#include "Himadri_DS3231_Stats.h"
+#include "Himadri_DS3231_Transport.h"
+
+#if defined(HIMADRI_DS3231_STATS)
+
+uint32_t Himadri_DS3231_Stats::txCount = 0;
+uint32_t Himadri_DS3231_Stats::txBytes = 0;
+uint32_t Himadri_DS3231_Stats::rxBytes = 0;
+uint32_t Himadri_DS3231_Stats::nackCount = 0;
+uint32_t Himadri_DS3231_Stats::errorCount = 0;
+uint8_t Himadri_DS3231_Stats::currentApi = DS3231_API_OTHER;
+uint8_t Himadri_DS3231_Stats::depth = 0;
+struct apiStatsParameters Himadri_DS3231_Stats::apiStats[DS3231_API_COUNT];
+
+/*-------------------------------
+  Public Function Definition
+-------------------------------*/
+
+/**
+  Count one register access.
+**/
+void Himadri_DS3231_Stats::bus(uint8_t status, uint8_t written, uint8_t read) {
+  txCount++;
+  txBytes += written;
+  if(status == DS3231_BUS_OK) {
+    rxBytes += read;
+  } else if(status == DS3231_BUS_NACK_ADDRESS || status == DS3231_BUS_NACK_DATA) {
+    nackCount++;
+  } else {
+    errorCount++;
+  }
+
+  apiStats[currentApi].transactions++;
+  apiStats[currentApi].bytes += written;
+  if(status == DS3231_BUS_OK) {
+    apiStats[currentApi].bytes += read;
+  }
+};
+
+/**
+  Enter a public API, only the outermost call is charged.
+**/
+boolean Himadri_DS3231_Stats::enter(uint8_t id) {
+  if(depth++ > 0 || id >= DS3231_API_COUNT) {
+    return false;
+  }
+  currentApi = id;
+  if(apiStats[id].calls != 0xFFFF) {
+    apiStats[id].calls++;
+  }
+  return true;
+};
+
+/**
+  Leave a public API and add the call duration to its histogram.
+**/
+void Himadri_DS3231_Stats::leave(uint8_t id, boolean outer, unsigned long elapsed) {
+  depth--;
+  if(outer == false) {
+    return;
+  }
+  currentApi = DS3231_API_OTHER;
+
+  #if defined(HIMADRI_DS3231_STATS_LATENCY)
+    struct apiStatsParameters* stats = &apiStats[id];
+    uint8_t bucket = 0;
+    unsigned long limit = 64;
+
+    while(bucket < DS3231_STATS_BUCKETS - 1 && elapsed >= limit) {
+      bucket++;
+      limit <<= 1;
+    }
+    if(stats->buckets[bucket] != 0xFFFF) {
+      stats->buckets[bucket]++;
+    }
+    if(elapsed > stats->maxMicros) {
+      stats->maxMicros = elapsed;
+    }
+  #else
+    (void)id;
+    (void)elapsed;
+  #endif
+};
+
+uint32_t Himadri_DS3231_Stats::transactions() {
+  return txCount;
+};
+
+uint32_t Himadri_DS3231_Stats::bytesWritten() {
+  return txBytes;
+};
+
+uint32_t Himadri_DS3231_Stats::bytesRead() {
+  return rxBytes;
+};
+
+uint32_t Himadri_DS3231_Stats::nacks() {
+  return nackCount;
+};
+
+uint32_t Himadri_DS3231_Stats::errors() {
+  return errorCount;
+};
+
+/**
+  Get the statistics of a public API.
+**/
+const struct apiStatsParameters* Himadri_DS3231_Stats::api(uint8_t id) {
+  if(id >= DS3231_API_COUNT) {
+    return NULL;
+  }
+  return &apiStats[id];
+};
+
+/**
+  Reset all counters and histograms to 0.
+**/
+void Himadri_DS3231_Stats::reset() {
+  txCount = 0;
+  txBytes = 0;
+  rxBytes = 0;
+  nackCount = 0;
+  errorCount = 0;
+  memset(apiStats, 0, sizeof(apiStats));
+};
+
+/**
+  Enter the public API for the lifetime of the scope.
+**/
+Himadri_DS3231_StatsScope::Himadri_DS3231_StatsScope(uint8_t id) {
+  apiId = id;
+  outer = Himadri_DS3231_Stats::enter(id);
+  #if defined(HIMADRI_DS3231_STATS_LATENCY)
+    start = micros();
+  #endif
+};
+
+/**
+  Leave the public API with the time spent in it.
+**/
+Himadri_DS3231_StatsScope::~Himadri_DS3231_StatsScope() {
+  #if defined(HIMADRI_DS3231_STATS_LATENCY)
+    Himadri_DS3231_Stats::leave(apiId, outer, micros() - start);
+  #else
+    Himadri_DS3231_Stats::leave(apiId, outer, 0);
+  #endif
+};
+
+/*-------------------------------
+  Public Function Definition
+-------------------------------*/
+
+#endif
+
+/******************************
+     DS3231 RTC Instrumentation
+******************************/
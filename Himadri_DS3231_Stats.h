@@ -0,0 +1,237 @@
+/******************************
+     DS3231 RTC Instrumentation
+
+Bus counters and latency histograms of the DS3231 driver, to find which
+calls dominate the I2C bus budget. Everything is compiled out unless
+HIMADRI_DS3231_STATS is defined, below or on the compiler command line.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+The instrumentation implements the following features:
+  1. Transactions, bytes written / read, NACKs and other bus errors of
+     every register access
+  2. Calls, transactions and bytes per public API, the traffic of nested
+     calls is charged to the outermost API
+  3. micros() latency histogram and maximum per public API with
+     HIMADRI_DS3231_STATS_LATENCY
+
+******************************/
+
+/**
+    Himadri_DS3231_Stats.h
+    Purpose: Header file for Himadri_DS3231_Stats.cpp. Contains the all function declaration.
+*/
+
+#ifndef HIMADRI_DS3231_STATS_H
+
+  #define HIMADRI_DS3231_STATS_H
+
+  #if (ARDUINO >= 100)
+    #include <Arduino.h>
+  #else
+    #include <WProgram.h>
+  #endif
+
+  /*-------------------------------
+      Instrumentation Switch
+  -------------------------------*/
+  // #define HIMADRI_DS3231_STATS
+  // #define HIMADRI_DS3231_STATS_LATENCY
+
+  #if defined(HIMADRI_DS3231_STATS_LATENCY) && !defined(HIMADRI_DS3231_STATS)
+    #define HIMADRI_DS3231_STATS
+  #endif
+  /*-------------------------------
+      Instrumentation Switch
+  -------------------------------*/
+
+  /*-------------------------------
+        Public API Identifier
+  -------------------------------*/
+  #define DS3231_API_OTHER                0x00    // Bus traffic outside a public API
+  #define DS3231_API_BEGIN                0x01    // begin
+  #define DS3231_API_REFRESH_SHADOW       0x02    // refreshShadow
+  #define DS3231_API_CLEAR_INT_STATUS     0x03    // clearINTStatus
+  #define DS3231_API_CLEAR_TIME_REGISTER  0x04    // clearTimeRegister
+  #define DS3231_API_SET_DATE_TIME        0x05    // setDateTime
+  #define DS3231_API_SET_SECONDS          0x06    // setSeconds
+  #define DS3231_API_SET_MINUTES          0x07    // setMinutes
+  #define DS3231_API_SET_HOUR             0x08    // setHour
+  #define DS3231_API_SET_DAY              0x09    // setDay
+  #define DS3231_API_SET_DATE             0x0A    // setDate
+  #define DS3231_API_SET_MONTH            0x0B    // setMonth
+  #define DS3231_API_SET_YEAR             0x0C    // setYear
+  #define DS3231_API_READ_DATE_TIME       0x0D    // readDateTime
+  #define DS3231_API_READ_EPOCH           0x0E    // readEpoch
+  #define DS3231_API_SET_EPOCH            0x0F    // setEpoch
+  #define DS3231_API_READ_EPOCH64         0x10    // readEpoch64
+  #define DS3231_API_SET_EPOCH64          0x11    // setEpoch64
+  #define DS3231_API_READ_SNAPSHOT        0x12    // readSnapshot
+  #define DS3231_API_SET_ALARM            0x13    // setAlarm (all overloads)
+  #define DS3231_API_SET_ALARM_EPOCH      0x14    // setAlarmEpoch
+  #define DS3231_API_ENABLE_ALARM         0x15    // enableAlarm
+  #define DS3231_API_DISABLE_ALARM        0x16    // disableAlarm
+  #define DS3231_API_ALARM_STATUS         0x17    // alarmStatus
+  #define DS3231_API_READ_ALARM_TIME      0x18    // readAlarmTime
+  #define DS3231_API_READ_TEMP            0x19    // readTemp
+  #define DS3231_API_CONVERT_TEMP         0x1A    // convertTemp
+  #define DS3231_API_START_CONVERT_TEMP   0x1B    // startConvertTemp
+  #define DS3231_API_POLL_CONVERT_TEMP    0x1C    // pollConvertTemp
+  #define DS3231_API_CONTROL_REG_VALUE    0x1D    // controlRegValue
+  #define DS3231_API_OSCILLATOR           0x1E    // enableDisableOscillator
+  #define DS3231_API_OSCILLATOR_STATUS    0x1F    // oscillatorStatus
+  #define DS3231_API_BBSQW                0x20    // enableDisableBBSQW
+  #define DS3231_API_BBSQW_STATUS         0x21    // bbsqwStatus
+  #define DS3231_API_INTCN_STATUS         0x22    // intcnStatus
+  #define DS3231_API_SET_SQW_FREQUENCY    0x23    // setSQWFrequency
+  #define DS3231_API_SQW_FREQUENCY        0x24    // sqwFrequency
+  #define DS3231_API_STATUS_REG_VALUE     0x25    // statusRegValue
+  #define DS3231_API_OSF_STATUS           0x26    // osfStatus
+  #define DS3231_API_EN32KHZ              0x27    // enableDisable32Khz
+  #define DS3231_API_EN32KHZ_STATUS       0x28    // en32KhzStatus
+  #define DS3231_API_BSY_STATUS           0x29    // bsyStatus
+  #define DS3231_API_AGING_REG_VALUE      0x2A    // agingRegValue
+  #define DS3231_API_SET_AGING_REG_VALUE  0x2B    // setAgingRegValue
+  #define DS3231_API_READ_TEMP_RAW        0x2C    // readTempRaw
+  #define DS3231_API_READ_TEMP_CENTI      0x2D    // readTempCentiDegrees
+  #define DS3231_API_SET_DATE_TIME_ATOMIC 0x2E    // setDateTimeAtomic
+  #define DS3231_API_SET_EPOCH_ALIGNED    0x2F    // setEpochAligned
+  #define DS3231_API_READ_CLEAR_ALARMS    0x30    // readClearAlarmStatus
+  #define DS3231_API_BEGIN_CONFIG         0x31    // beginConfig
+  #define DS3231_API_COMMIT               0x32    // commit
+  #define DS3231_API_COUNT                0x33
+  /*-------------------------------
+        Public API Identifier
+  -------------------------------*/
+
+  /*-------------------------------
+    Latency Histogram Buckets
+    Bucket 0 is below 64us, bucket n
+    is 2^(n+5)us up to 2^(n+6)us and
+    the last bucket is open ended
+  -------------------------------*/
+  #define DS3231_STATS_BUCKETS        8
+  /*-------------------------------
+    Latency Histogram Buckets
+  -------------------------------*/
+
+  #if defined(HIMADRI_DS3231_STATS)
+
+    /*-------------------------------
+         Per API Statistics
+        Structure Declaration
+    -------------------------------*/
+    struct apiStatsParameters {
+      uint16_t calls;                           // outermost calls
+      uint32_t transactions;                    // register accesses
+      uint32_t bytes;                           // bytes written and read
+      #if defined(HIMADRI_DS3231_STATS_LATENCY)
+        uint32_t maxMicros;                     // longest call
+        uint16_t buckets[DS3231_STATS_BUCKETS]; // latency histogram
+      #endif
+    };
+
+    class Himadri_DS3231_Stats {
+      /*-------------------------------
+        Private Function Declaration
+      -------------------------------*/
+      private:
+        static uint32_t txCount;
+        static uint32_t txBytes;
+        static uint32_t rxBytes;
+        static uint32_t nackCount;
+        static uint32_t errorCount;
+        static uint8_t currentApi;              // outermost API in progress
+        static uint8_t depth;                   // nesting of public API calls
+        static struct apiStatsParameters apiStats[DS3231_API_COUNT];
+
+      /*-------------------------------
+        Public Function Declaration
+      -------------------------------*/
+      public:
+        /**
+          Count one register access. Called by the driver.
+
+          @param status The transport status code
+          @param written Bytes written including the register address
+          @param read Bytes read
+          @return Return void
+        */
+        static void bus(uint8_t status, uint8_t written, uint8_t read);
+
+        /**
+          Enter a public API. Called by Himadri_DS3231_StatsScope.
+
+          @param id The DS3231_API_* identifier
+          @return Return true for the outermost call
+        */
+        static boolean enter(uint8_t id);
+
+        /**
+          Leave a public API. Called by Himadri_DS3231_StatsScope.
+
+          @param id The DS3231_API_* identifier
+          @param outer True for the outermost call
+          @param elapsed Duration of the call in microseconds
+          @return Return void
+        */
+        static void leave(uint8_t id, boolean outer, unsigned long elapsed);
+
+        static uint32_t transactions(void);
+        static uint32_t bytesWritten(void);
+        static uint32_t bytesRead(void);
+        static uint32_t nacks(void);
+        static uint32_t errors(void);
+
+        /**
+          Get the statistics of a public API
+
+          @param id The DS3231_API_* identifier
+          @return Return pointer to the statistics, NULL for an unknown API
+        */
+        static const struct apiStatsParameters* api(uint8_t id);
+
+        /**
+          Reset all counters and histograms to 0
+
+          @return Return void
+        */
+        static void reset(void);
+    };
+
+    /*-------------------------------
+      Public API Scope, charges the
+      calls and the latency to the
+      API while it is in scope
+    -------------------------------*/
+    class Himadri_DS3231_StatsScope {
+      private:
+        uint8_t apiId;
+        boolean outer;
+        #if defined(HIMADRI_DS3231_STATS_LATENCY)
+          unsigned long start;
+        #endif
+
+      public:
+        Himadri_DS3231_StatsScope(uint8_t id);
+        ~Himadri_DS3231_StatsScope();
+    };
+
+    #define DS3231_STATS_API(api)       Himadri_DS3231_StatsScope ds3231StatsScope(api)
+    #define DS3231_STATS_BUS(status, written, read) Himadri_DS3231_Stats::bus(status, written, read)
+
+  #else
+
+    #define DS3231_STATS_API(api)
+    #define DS3231_STATS_BUS(status, written, read)
+
+  #endif
+
+#endif
+
+/******************************
+     DS3231 RTC Instrumentation
+******************************/
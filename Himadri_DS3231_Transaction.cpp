@@ -0,0 +1,120 @@
+/******************************
+     DS3231 RTC Setter Transaction
+
+Fluent builder collecting changes of the individual timekeeping fields.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+******************************/
+
+#include "Himadri_DS3231_Transaction.h"
+
+/*-------------------------------
+  Public Function Definition
+-------------------------------*/
+
+/**
+  Create an empty transaction for a DS3231.
+**/
+Himadri_DS3231_Transaction::Himadri_DS3231_Transaction(Himadri_DS3231& ds3231) {
+  rtc = &ds3231;
+  clear();
+};
+
+/**
+  Set Seconds.
+**/
+Himadri_DS3231_Transaction& Himadri_DS3231_Transaction::seconds(uint8_t ss) {
+  this->ss = ss;
+  dirty |= 1 << DS3231_SECONDS_REG;
+  return *this;
+};
+
+/**
+  Set Minutes.
+**/
+Himadri_DS3231_Transaction& Himadri_DS3231_Transaction::minutes(uint8_t mm) {
+  this->mm = mm;
+  dirty |= 1 << DS3231_MINUTES_REG;
+  return *this;
+};
+
+/**
+  Set Hour by passing timeformat and meridian.
+**/
+Himadri_DS3231_Transaction& Himadri_DS3231_Transaction::hour(uint8_t hh, boolean tf, boolean md) {
+  this->hh = hh;
+  this->tf = tf;
+  this->md = md;
+  dirty |= 1 << DS3231_HOUR_REG;
+  return *this;
+};
+
+/**
+  Set Day of the week.
+**/
+Himadri_DS3231_Transaction& Himadri_DS3231_Transaction::day(uint8_t day) {
+  dy = day;
+  dirty |= 1 << DS3231_DAY_REG;
+  return *this;
+};
+
+/**
+  Set Date of the month.
+**/
+Himadri_DS3231_Transaction& Himadri_DS3231_Transaction::date(uint8_t date) {
+  d = date;
+  dirty |= 1 << DS3231_DATE_REG;
+  return *this;
+};
+
+/**
+  Set Month of the Year.
+**/
+Himadri_DS3231_Transaction& Himadri_DS3231_Transaction::month(uint8_t month, boolean century) {
+  m = month;
+  cy = century;
+  dirty |= 1 << DS3231_MONTH_REG;
+  return *this;
+};
+
+/**
+  Set Year.
+**/
+Himadri_DS3231_Transaction& Himadri_DS3231_Transaction::year(uint16_t year) {
+  y = year;
+  dirty |= 1 << DS3231_YEAR_REG;
+  return *this;
+};
+
+/**
+  Validate the collected fields and write them.
+**/
+boolean Himadri_DS3231_Transaction::commit() {
+  return rtc->commit(*this);
+};
+
+/**
+  Drop the collected fields.
+**/
+Himadri_DS3231_Transaction& Himadri_DS3231_Transaction::clear() {
+  dirty = 0;
+  ss = 0;
+  mm = 0;
+  hh = 0;
+  tf = false;
+  md = false;
+  dy = 1;
+  d = 1;
+  m = 1;
+  cy = true;
+  y = 2000;
+  return *this;
+};
+
+/******************************
+     DS3231 RTC Setter Transaction
+******************************/
@@ -0,0 +1,147 @@
+/******************************
+     DS3231 RTC Setter Transaction
+
+Fluent builder collecting changes of the individual timekeeping fields.
+Nothing is sent until commit(), which validates all fields together and
+writes every run of consecutive changed registers in one burst, so
+seconds, minutes and hour cost one transaction instead of three.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+This class implements the following features:
+  1. Same fields and ranges as setSeconds / setMinutes / setHour / setDay /
+     setDate / setMonth / setYear
+  2. No write at all when any field is out of range or the resulting date
+     does not exist
+  3. One burst write per run of consecutive changed registers, plus one
+     Date / Month / Year read only when some but not all of them change
+
+  Himadri_DS3231_Transaction tx(ds3231);
+  tx.seconds(0).minutes(30).hour(6, false, false).commit();
+
+******************************/
+
+/**
+    Himadri_DS3231_Transaction.h
+    Purpose: Header file for Himadri_DS3231_Transaction.cpp. Contains the all function declaration.
+*/
+
+#ifndef HIMADRI_DS3231_TRANSACTION_H
+
+  #define HIMADRI_DS3231_TRANSACTION_H
+
+  #include "Himadri_DS3231.h"
+
+  class Himadri_DS3231_Transaction {
+    /*-------------------------------
+      Private Function Declaration
+    -------------------------------*/
+    private:
+      Himadri_DS3231* rtc;
+
+    /*-------------------------------
+      Public Function Declaration
+    -------------------------------*/
+    public:
+      uint8_t dirty;              // bit n set when the register at address n changes
+      uint8_t ss;
+      uint8_t mm;
+      uint8_t hh;
+      boolean tf;                 // true for 12 Hour format
+      boolean md;                 // true for PM
+      uint8_t dy;                 // day of the week
+      uint8_t d;
+      uint8_t m;
+      boolean cy;                 // true for 2000 - 2099, the year decides when it is set
+      uint16_t y;
+
+      /**
+        Create an empty transaction for a DS3231
+
+        @param ds3231 The DS3231 driver used by commit
+      */
+      Himadri_DS3231_Transaction(Himadri_DS3231& ds3231);
+
+      /**
+        Set Seconds
+
+        @param ss Seconds unsigned integer value
+        @return Return the transaction
+      */
+      Himadri_DS3231_Transaction& seconds(uint8_t ss);
+
+      /**
+        Set Minutes
+
+        @param mm Minutes unsigned integer value
+        @return Return the transaction
+      */
+      Himadri_DS3231_Transaction& minutes(uint8_t mm);
+
+      /**
+        Set Hour by passing timeformat and meridian
+
+        @param hh Hour unsigned integer value
+        @param tf Boolean for Timeformat 12 / 24. True for 12 and false for 24
+        @param md Boolean for Meridian AM / PM. True for PM and false for AM
+        @return Return the transaction
+      */
+      Himadri_DS3231_Transaction& hour(uint8_t hh, boolean tf, boolean md);
+
+      /**
+        Set Day of the week
+
+        @param day Day unsigned value. Week start with Sunday as 1 and Sturday as 7
+        @return Return the transaction
+      */
+      Himadri_DS3231_Transaction& day(uint8_t day);
+
+      /**
+        Set Date of the month
+
+        @param date Date of the month unsigned integer value
+        @return Return the transaction
+      */
+      Himadri_DS3231_Transaction& date(uint8_t date);
+
+      /**
+        Set Month of the Year
+
+        @param month Month of the year unsigned integer value
+        @param century True for the years 2000 - 2099, ignored when the year is set too
+        @return Return the transaction
+      */
+      Himadri_DS3231_Transaction& month(uint8_t month, boolean century = true);
+
+      /**
+        Set Year
+
+        @param year Year unsigned integer value 1900 - 2099
+        @return Return the transaction
+      */
+      Himadri_DS3231_Transaction& year(uint16_t year);
+
+      /**
+        Validate the collected fields and write them, see
+        Himadri_DS3231::commit. The fields stay collected.
+
+        @return Return boolean
+      */
+      boolean commit(void);
+
+      /**
+        Drop the collected fields
+
+        @return Return the transaction
+      */
+      Himadri_DS3231_Transaction& clear(void);
+  };
+
+#endif
+
+/******************************
+     DS3231 RTC Setter Transaction
+******************************/
@@ -0,0 +1,95 @@
+/******************************
+     DS3231 RTC Transport
+
+Register level bus interface of the DS3231 driver. The driver only reads
+and writes blocks of consecutive registers, so any bus that can do that
+can carry it: the Arduino TwoWire library, Linux i2c-dev or the
+in-memory simulator.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+******************************/
+
+/**
+    Himadri_DS3231_Transport.h
+    Purpose: Declaration of the transport interface used by Himadri_DS3231.
+*/
+
+#ifndef HIMADRI_DS3231_TRANSPORT_H
+
+  #define HIMADRI_DS3231_TRANSPORT_H
+
+  #if (ARDUINO >= 100)
+    #include <Arduino.h>
+  #else
+    #include <WProgram.h>
+  #endif
+
+  /*-------------------------------
+        Transport Status Codes
+    Same as Wire endTransmission()
+  -------------------------------*/
+  #define DS3231_BUS_OK               0x00    // Success
+  #define DS3231_BUS_TOO_LONG         0x01    // Data too long for the buffer
+  #define DS3231_BUS_NACK_ADDRESS     0x02    // NACK on transmit of address
+  #define DS3231_BUS_NACK_DATA        0x03    // NACK on transmit of data
+  #define DS3231_BUS_ERROR            0x04    // Other error
+  #define DS3231_BUS_SHORT_READ       0x05    // Less bytes received than requested
+  /*-------------------------------
+        Transport Status Codes
+    Same as Wire endTransmission()
+  -------------------------------*/
+
+  class Himadri_DS3231_Transport {
+    /*-------------------------------
+      Public Function Declaration
+    -------------------------------*/
+    public:
+      /**
+        Destroy the transport through a pointer to the interface
+      */
+      virtual ~Himadri_DS3231_Transport() {}
+
+      /**
+        Initialize the bus
+
+        @return Return void
+      */
+      virtual void begin(void) = 0;
+
+      /**
+        Address the device without data to check that it acknowledges
+
+        @return Return DS3231_BUS_OK or the transport status code
+      */
+      virtual uint8_t probe(void) = 0;
+
+      /**
+        Reads consecutive registers in a single transaction
+
+        @param regaddress The address of the first register to read
+        @param buf Buffer receiving the register values
+        @param len Number of registers to read
+        @return Return DS3231_BUS_OK or the transport status code
+      */
+      virtual uint8_t readRegisters(uint8_t regaddress, uint8_t* buf, uint8_t len) = 0;
+
+      /**
+        Writes consecutive registers in a single transaction
+
+        @param regaddress The address of the first register to write
+        @param buf Register values to write
+        @param len Number of registers to write
+        @return Return DS3231_BUS_OK or the transport status code
+      */
+      virtual uint8_t writeRegisters(uint8_t regaddress, const uint8_t* buf, uint8_t len) = 0;
+  };
+
+#endif
+
+/******************************
+     DS3231 RTC Transport
+******************************/
@@ -0,0 +1,117 @@
+/******************************
+   DS3231 RTC Wire Transport
+
+Transport of the DS3231 driver over the Arduino TwoWire library.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+******************************/
+
+#include "Himadri_DS3231_WireTransport.h"
+
+/*-------------------------------
+  Public Function Definition
+-------------------------------*/
+
+/**
+  Create the transport on a TwoWire bus.
+**/
+Himadri_DS3231_WireTransport::Himadri_DS3231_WireTransport(TwoWire& bus, uint8_t address) {
+  wire = &bus;
+  deviceAddress = address;
+};
+
+/**
+  Initialize the TwoWire bus.
+**/
+void Himadri_DS3231_WireTransport::begin() {
+  wire->begin();
+};
+
+/**
+  Address the device without data.
+**/
+uint8_t Himadri_DS3231_WireTransport::probe() {
+  return probe(*wire, deviceAddress);
+};
+
+/**
+  Reads consecutive registers in a single transaction.
+**/
+uint8_t Himadri_DS3231_WireTransport::readRegisters(uint8_t regaddress, uint8_t* buf, uint8_t len) {
+  return readRegisters(*wire, deviceAddress, regaddress, buf, len);
+};
+
+/**
+  Writes consecutive registers in a single transaction.
+**/
+uint8_t Himadri_DS3231_WireTransport::writeRegisters(uint8_t regaddress, const uint8_t* buf, uint8_t len) {
+  return writeRegisters(*wire, deviceAddress, regaddress, buf, len);
+};
+
+/**
+  Address a device on a TwoWire bus without data.
+**/
+uint8_t Himadri_DS3231_WireTransport::probe(TwoWire& bus, uint8_t address) {
+  bus.beginTransmission(address);
+  return bus.endTransmission();
+};
+
+/**
+  Reads consecutive registers of a device on a TwoWire bus in a single transaction.
+**/
+uint8_t Himadri_DS3231_WireTransport::readRegisters(TwoWire& bus, uint8_t address, uint8_t regaddress, uint8_t* buf, uint8_t len) {
+  bus.beginTransmission(address);
+  #if (ARDUINO >= 100)
+    bus.write((byte)regaddress);
+  #else
+    bus.send((byte)regaddress);
+  #endif
+  uint8_t status = bus.endTransmission();
+  if(status != DS3231_BUS_OK) {
+    return status;
+  }
+
+  if(bus.requestFrom((int)address, (int)len, true) != len) {
+    return DS3231_BUS_SHORT_READ;
+  }
+  for(uint8_t i = 0; i < len; i++) {
+    #if (ARDUINO >= 100)
+      buf[i] = bus.read();        // receive DATA
+    #else
+      buf[i] = bus.receive();     // receive DATA
+    #endif
+  }
+  return DS3231_BUS_OK;
+};
+
+/**
+  Writes consecutive registers of a device on a TwoWire bus in a single transaction.
+**/
+uint8_t Himadri_DS3231_WireTransport::writeRegisters(TwoWire& bus, uint8_t address, uint8_t regaddress, const uint8_t* buf, uint8_t len) {
+  bus.beginTransmission(address);
+
+  #if (ARDUINO >= 100)
+    bus.write((byte)regaddress);
+    for(uint8_t i = 0; i < len; i++) {
+      bus.write((byte)buf[i]);
+    }
+  #else
+    bus.send((byte)regaddress);
+    for(uint8_t i = 0; i < len; i++) {
+      bus.send((byte)buf[i]);
+    }
+  #endif
+  return bus.endTransmission();
+};
+
+/*-------------------------------
+  Public Function Definition
+-------------------------------*/
+
+/******************************
+   DS3231 RTC Wire Transport
+******************************/
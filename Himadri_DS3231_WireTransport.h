@@ -0,0 +1,93 @@
+/******************************
+   DS3231 RTC Wire Transport
+
+Transport of the DS3231 driver over the Arduino TwoWire library. It is the
+only place where the Wire.write / Wire.send split between Arduino 1.0 and
+the earlier cores is made.
+
+@author <a href="mailto:himadri@colourdrift.com">Himadri Ganguly</a>
+@version 1.0.0 19/08/2017
+
+Available from:  https://github.com/himadriganguly/Himadri_DS3231
+
+******************************/
+
+/**
+    Himadri_DS3231_WireTransport.h
+    Purpose: Header file for Himadri_DS3231_WireTransport.cpp. Contains the all function declaration.
+*/
+
+#ifndef HIMADRI_DS3231_WIRE_TRANSPORT_H
+
+  #define HIMADRI_DS3231_WIRE_TRANSPORT_H
+
+  #include <Wire.h>
+  #include "Himadri_DS3231_Transport.h"
+
+  class Himadri_DS3231_WireTransport : public Himadri_DS3231_Transport {
+    /*-------------------------------
+      Private Function Declaration
+    -------------------------------*/
+    private:
+      TwoWire* wire;
+      uint8_t deviceAddress;
+
+    /*-------------------------------
+      Public Function Declaration
+    -------------------------------*/
+    public:
+      /**
+        Create the transport on a TwoWire bus
+
+        @param bus The TwoWire bus the DS3231 is connected to
+        @param address The I2C slave address of the DS3231
+      */
+      Himadri_DS3231_WireTransport(TwoWire& bus, uint8_t address);
+
+      void begin(void);
+      uint8_t probe(void);
+      uint8_t readRegisters(uint8_t regaddress, uint8_t* buf, uint8_t len);
+      uint8_t writeRegisters(uint8_t regaddress, const uint8_t* buf, uint8_t len);
+
+      /**
+        Address a device on a TwoWire bus without data, for drivers that
+        reach the bus without a transport object
+
+        @param bus The TwoWire bus the DS3231 is connected to
+        @param address The I2C slave address of the DS3231
+        @return Return DS3231_BUS_OK or the transport status code
+      */
+      static uint8_t probe(TwoWire& bus, uint8_t address);
+
+      /**
+        Reads consecutive registers of a device on a TwoWire bus in a single
+        transaction
+
+        @param bus The TwoWire bus the DS3231 is connected to
+        @param address The I2C slave address of the DS3231
+        @param regaddress The address of the first register to read
+        @param buf Buffer receiving the register values
+        @param len Number of registers to read
+        @return Return DS3231_BUS_OK or the transport status code
+      */
+      static uint8_t readRegisters(TwoWire& bus, uint8_t address, uint8_t regaddress, uint8_t* buf, uint8_t len);
+
+      /**
+        Writes consecutive registers of a device on a TwoWire bus in a
+        single transaction
+
+        @param bus The TwoWire bus the DS3231 is connected to
+        @param address The I2C slave address of the DS3231
+        @param regaddress The address of the first register to write
+        @param buf Register values to write
+        @param len Number of registers to write
+        @return Return DS3231_BUS_OK or the transport status code
+      */
+      static uint8_t writeRegisters(TwoWire& bus, uint8_t address, uint8_t regaddress, const uint8_t* buf, uint8_t len);
+  };
+
+#endif
+
+/******************************
+   DS3231 RTC Wire Transport
+******************************/
@@ -0,0 +1,52 @@
+#include <Himadri_DS3231.h>
+#include <Himadri_DS3231_Events.h>
+
+// Please checkout the wiring diagram of the setAlarm example, INT/SQW of the DS3231 goes to PIN 2.
+
+// declaring object of the DS3231 class
+Himadri_DS3231 ds3231;
+
+// The dispatcher queues the interrupt edges and calls the handlers from loop()
+Himadri_DS3231_Events events(ds3231);
+
+// The PIN 2 is the interrupt 0 PIN in Arduino UNO
+const int intPin = 2;
+
+// Handlers run in loop() through events.pump(), so Serial and I2C can be used here
+void onAlarm1(uint8_t alarm, unsigned long edgeMicros) {
+  Serial.print("Alarm1 at micros ");
+  Serial.println(edgeMicros);
+}
+
+void onAlarm2(uint8_t alarm, unsigned long edgeMicros) {
+  Serial.print("Alarm2 at micros ");
+  Serial.println(edgeMicros);
+}
+
+void setup() {
+  Serial.begin(9600);
+
+  if (!ds3231.begin()) {
+    Serial.println("Could not find a valid DS3231 sensor, check wiring!");
+    while (1) {}
+  }
+  Serial.println("Initialization Done!");
+
+  // Alarm1 every minute when seconds are 0, Alarm2 every hour when minutes are 0
+  ds3231.setAlarm(Minute, Alarm1);
+  ds3231.setAlarm(Hour, Alarm2);
+  ds3231.enableAlarm(BothAlarm);
+
+  events.onAlarm(Alarm1, onAlarm1);
+  events.onAlarm(Alarm2, onAlarm2);
+  events.begin(intPin);
+}
+
+void loop() {
+  // Reads and clears the alarm flags only after an interrupt, otherwise no I2C traffic
+  events.pump();
+
+  if (events.droppedEvents() != 0) {
+    Serial.println("Alarm events lost, call pump() more often");
+  }
+}
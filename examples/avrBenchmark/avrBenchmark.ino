@@ -0,0 +1,262 @@
+/*
+  AVR benchmark of the DS3231 library.
+
+  Runs the public API on an ATmega328P against the in-memory simulated
+  DS3231 (Himadri_DS3231_Sim used as the transport), so only the CPU work
+  of the library is measured: BCD conversion, string parsing, float math
+  and the epoch calculation. Timer1 counts the CPU cycles of every call
+  and the stack is painted to find the deepest stack use of every call.
+
+  It runs on a 16MHz Uno / Nano or under simavr:
+
+    arduino-cli compile -b arduino:avr:uno --output-dir build examples/avrBenchmark
+    simavr -m atmega328p -f 16000000 build/avrBenchmark.ino.elf
+
+  Flash used by the library functions:
+
+    avr-size -C --mcu=atmega328p build/avrBenchmark.ino.elf
+    avr-nm -C --size-sort -S build/avrBenchmark.ino.elf | grep Himadri_DS3231
+
+  To compare the BCD table with the per-field arithmetic conversion add
+  the define to the build and run it again:
+
+    arduino-cli compile -b arduino:avr:uno --output-dir build \
+      --build-property compiler.cpp.extra_flags=-DHIMADRI_DS3231_BCD_ARITHMETIC \
+      examples/avrBenchmark
+
+  The transport rows are the cost of the simulated chip itself, subtract
+  them from the rows using the same transfers to get the library cost.
+  The Timer0 interrupt behind millis() stays enabled and adds below 1%.
+*/
+
+#include <Himadri_DS3231.h>
+#include <Himadri_DS3231_Sim.h>
+#include <Himadri_DS3231_AlarmSpec.h>
+#include <Himadri_DS3231_Transaction.h>
+
+#if !defined(__AVR__)
+  #error "This benchmark measures AVR cycles with Timer1"
+#endif
+
+#define RUNS          16        // calls per measurement
+#define STACK_PAINT   0xA5      // pattern painted below the stack
+
+// The simulated chip is the transport, no I2C peripheral is used
+Himadri_DS3231_Sim chip;
+Himadri_DS3231 ds3231(chip);
+
+volatile uint16_t overflows = 0;
+uint32_t emptyCycles = 0;
+volatile uint32_t sink = 0;
+
+extern uint8_t __heap_start;
+extern void* __brkval;
+
+ISR(TIMER1_OVF_vect) {
+  overflows++;
+}
+
+// Run the operation RUNS times and return the cycles per call
+uint32_t cyclesPerCall(void (*op)(void)) {
+  uint16_t count;
+  uint32_t cycles;
+
+  noInterrupts();
+  overflows = 0;
+  TCNT1 = 0;
+  TIFR1 = _BV(TOV1);
+  interrupts();
+
+  for (uint8_t i = 0; i < RUNS; i++) {
+    op();
+  }
+
+  noInterrupts();
+  count = TCNT1;
+  // Overflow pending but not yet counted by the interrupt
+  if ((TIFR1 & _BV(TOV1)) && count < 0x8000) {
+    overflows++;
+  }
+  cycles = ((uint32_t)overflows << 16) | count;
+  interrupts();
+
+  return cycles / RUNS;
+}
+
+// Returns the deepest stack use of the operation in bytes
+uint16_t stackBytes(void (*op)(void)) {
+  uint8_t* bottom = __brkval == 0 ? &__heap_start : (uint8_t*)__brkval;
+  uint8_t* top = (uint8_t*)SP;
+  uint8_t* p;
+
+  for (p = bottom; p < top; p++) {
+    *p = STACK_PAINT;
+  }
+  op();
+  for (p = bottom; p < top && *p == STACK_PAINT; p++) {
+  }
+  return top - p;
+}
+
+void report(const __FlashStringHelper* name, void (*op)(void)) {
+  uint32_t cycles = cyclesPerCall(op) - emptyCycles;
+  uint16_t stack = stackBytes(op);
+
+  Serial.print(name);
+  Serial.print('\t');
+  Serial.print(cycles);
+  Serial.print('\t');
+  Serial.print(cycles / (F_CPU / 1000000UL));
+  Serial.print('\t');
+  Serial.println(stack);
+}
+
+// Operations under test
+void opEmpty() {
+}
+
+void opTransportRead7() {
+  uint8_t buf[7];
+  chip.readRegisters(DS3231_SECONDS_REG, buf, 7);
+  sink += buf[0];
+}
+
+void opTransportWrite7() {
+  uint8_t buf[7] = {0x00, 0x30, 0x15, 0x03, 0x16, 0x10, 0x24};
+  chip.writeRegisters(DS3231_SECONDS_REG, buf, 7);
+}
+
+void opTransportRead2() {
+  uint8_t buf[2];
+  chip.readRegisters(DS3231_TEMPERATURE_MSG_REG, buf, 2);
+  sink += buf[0];
+}
+
+void opBeginConfig() {
+  configParameters config = {DS3231_CONFIG_CONTROL, DS3231_CONFIG_EN32KHZ};
+  sink += ds3231.beginConfig(&config);
+}
+
+void opInitializeDateTime() {
+  timeParameters timeVals;
+  sink += ds3231.initializeDateTime("Oct 16 2024 WED", "03:30:00 PM", &timeVals);
+}
+
+void opSetDateTime() {
+  timeParameters timeVals = {0, 0, 30, 15, 3, 4, 16, 10, 2024};
+  sink += ds3231.setDateTime(&timeVals);
+}
+
+void opSetDateTimeAtomic() {
+  timeParameters timeVals = {0, 0, 30, 15, 3, 4, 16, 10, 2024};
+  sink += ds3231.setDateTimeAtomic(&timeVals);
+}
+
+void opCommitSecMinHour() {
+  Himadri_DS3231_Transaction tx(ds3231);
+  sink += tx.seconds(0).minutes(30).hour(15, false, false).commit();
+}
+
+void opReadDateTime() {
+  timeParameters timeVals;
+  sink += ds3231.readDateTime(&timeVals);
+}
+
+void opReadEpoch() {
+  uint32_t epoch;
+  sink += ds3231.readEpoch(&epoch);
+}
+
+void opSetEpoch() {
+  sink += ds3231.setEpoch(1729092600UL);
+}
+
+void opSetAlarm() {
+  sink += ds3231.setAlarm(10, 20, 7, 15, false, false, false, Alarm1);
+}
+
+void opSetAlarmSpec() {
+  static constexpr Himadri_DS3231_AlarmSpec spec =
+    Himadri_DS3231_AlarmSpec::match(10, 20, 7, 15, false, false, false, Alarm1);
+  sink += ds3231.setAlarm(spec);
+}
+
+void opReadAlarmTime() {
+  alarmParameters alarmVals;
+  sink += ds3231.readAlarmTime(&alarmVals, Alarm1);
+}
+
+void opReadTempCelsius() {
+  sink += (uint32_t)ds3231.readTemp(Celsius);
+}
+
+void opReadTempFahrenheit() {
+  sink += (uint32_t)ds3231.readTemp(Fahrenheit);
+}
+
+void opReadTempRaw() {
+  int16_t quarterDegrees;
+  sink += ds3231.readTempRaw(&quarterDegrees);
+}
+
+void opReadTempCentiFahrenheit() {
+  int32_t centiDegrees;
+  sink += ds3231.readTempCentiDegrees(&centiDegrees, Fahrenheit);
+}
+
+void opReadSnapshot() {
+  snapshotParameters snapVals;
+  sink += ds3231.readSnapshot(&snapVals);
+}
+
+void opStatusRegValue() {
+  sink += ds3231.statusRegValue();
+}
+
+void opStatusRegValueCached() {
+  sink += ds3231.statusRegValue(true);
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  // Timer1 free running at F_CPU, counting CPU cycles
+  TCCR1A = 0;
+  TCCR1B = _BV(CS10);
+  TIMSK1 = _BV(TOIE1);
+
+  ds3231.begin();
+  opSetEpoch();
+
+  emptyCycles = cyclesPerCall(opEmpty);
+
+  Serial.print(F("free RAM\t"));
+  Serial.println((uint16_t)SP - (__brkval == 0 ? (uint16_t)&__heap_start : (uint16_t)__brkval));
+  Serial.println(F("api\tcycles\tus\tstack"));
+
+  report(F("transport read 7"), opTransportRead7);
+  report(F("transport write 7"), opTransportWrite7);
+  report(F("transport read 2"), opTransportRead2);
+  report(F("beginConfig"), opBeginConfig);
+  report(F("initializeDateTime"), opInitializeDateTime);
+  report(F("setDateTime"), opSetDateTime);
+  report(F("setDateTimeAtomic"), opSetDateTimeAtomic);
+  report(F("commit(ss,mm,hh)"), opCommitSecMinHour);
+  report(F("readDateTime"), opReadDateTime);
+  report(F("readEpoch"), opReadEpoch);
+  report(F("setEpoch"), opSetEpoch);
+  report(F("setAlarm(dyDt)"), opSetAlarm);
+  report(F("setAlarm(spec)"), opSetAlarmSpec);
+  report(F("readAlarmTime"), opReadAlarmTime);
+  report(F("readTemp(C)"), opReadTempCelsius);
+  report(F("readTemp(F)"), opReadTempFahrenheit);
+  report(F("readTempRaw"), opReadTempRaw);
+  report(F("readTempCentiDegrees(F)"), opReadTempCentiFahrenheit);
+  report(F("readSnapshot"), opReadSnapshot);
+  report(F("statusRegValue"), opStatusRegValue);
+  report(F("statusRegValue(cached)"), opStatusRegValueCached);
+  Serial.println(F("done"));
+}
+
+void loop() {
+}
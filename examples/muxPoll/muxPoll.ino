@@ -0,0 +1,50 @@
+#include <Himadri_DS3231.h>
+#include <Himadri_DS3231_Mux.h>
+
+// The DS3231 chips sit on channels 0 - 3 of a TCA9548A at address 0x70 on the Wire bus.
+
+// declaring the mux, it remembers the channel it selected last
+Himadri_DS3231_Mux mux(Wire);
+
+// One device per channel, each carries its own DS3231 driver
+Himadri_DS3231_MuxDevice rtc0(mux, 0);
+Himadri_DS3231_MuxDevice rtc1(mux, 1);
+Himadri_DS3231_MuxDevice rtc2(mux, 2);
+Himadri_DS3231_MuxDevice rtc3(mux, 3);
+
+Himadri_DS3231_MuxDevice* const rtcs[] = {&rtc0, &rtc1, &rtc2, &rtc3};
+const uint8_t rtcCount = sizeof(rtcs) / sizeof(rtcs[0]);
+
+void setup() {
+  Serial.begin(9600);
+
+  for (uint8_t i = 0; i < rtcCount; i++) {
+    uint8_t status = rtcs[i]->rtc.beginConfig(NULL);
+    if (status != DS3231_BEGIN_OK) {
+      Serial.print("DS3231 on channel ");
+      Serial.print(rtcs[i]->channel());
+      Serial.print(" failed with status 0x");
+      Serial.println(status, HEX);
+    }
+  }
+  Serial.println("Initialization Done!");
+}
+
+void loop() {
+  uint32_t epochs[rtcCount];
+
+  // Every channel is selected once, starting with the one left open by the last poll
+  uint8_t read = mux.poll(rtcs, rtcCount, epochs);
+
+  Serial.print(read);
+  Serial.print(" of ");
+  Serial.print(rtcCount);
+  Serial.print(" read:");
+  for (uint8_t i = 0; i < rtcCount; i++) {
+    Serial.print(' ');
+    Serial.print(epochs[i]);
+  }
+  Serial.println();
+
+  delay(1000);
+}
@@ -23,8 +23,9 @@ const int intPin = 2;
 volatile boolean state = false;
 
 // This is the Interrupt Service Routine function that will be called when the interrupt occur.
+// Serial and I2C must not be used here, the interrupt is handled in loop().
+// The alarmEvents example does this with the Himadri_DS3231_Events dispatcher.
 void isr() {
-  Serial.println("External Interrupt Detected");
   state = true;
 }
 
@@ -118,6 +119,9 @@ void loop() {
   }
 
   if(state == true) {
+    state = false;
+    Serial.println("External Interrupt Detected");
+
     // It will clear the Alarm Flag after the alarm interrupt.
     // Without clearing the flag it will do the interrupt for the second time.
     // ds3231.clearINTStatus(Alarm1);
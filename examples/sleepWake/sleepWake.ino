@@ -0,0 +1,63 @@
+#include <Himadri_DS3231.h>
+#include <Himadri_DS3231_Clock.h>
+#include <Himadri_DS3231_Sleep.h>
+
+// Please checkout the wiring diagram of the setAlarm example, INT/SQW of the DS3231 goes to PIN 2.
+
+// declaring object of the DS3231 class
+Himadri_DS3231 ds3231;
+
+// Software clock, the planner moves it to the wake edge after every sleep
+Himadri_DS3231_Clock swClock(ds3231, 0);
+
+// Programs Alarm1 for the next wake and puts the MCU in power down on AVR
+Himadri_DS3231_Sleep sleeper(ds3231, swClock);
+
+// The PIN 2 is the interrupt 0 PIN in Arduino UNO
+const int intPin = 2;
+
+// Seconds between two samples, the wakes land on :00, :10, :20 ...
+const uint32_t samplePeriod = 10;
+
+// Milliseconds spent in sleep, millis() does not count them
+unsigned long totalSlept = 0;
+
+void setup() {
+  Serial.begin(9600);
+
+  if (!ds3231.begin()) {
+    Serial.println("Could not find a valid DS3231 sensor, check wiring!");
+    while (1) {}
+  }
+  Serial.println("Initialization Done!");
+
+  swClock.sync();
+  sleeper.begin(intPin);
+}
+
+void loop() {
+  uint16_t ms;
+  uint32_t now = swClock.now(&ms);
+
+  Serial.print("Sample at ");
+  Serial.print(now);
+  Serial.print('.');
+  Serial.print(ms);
+  Serial.print(" slept ");
+  Serial.print(totalSlept);
+  Serial.println(" ms in total");
+
+  if (sleeper.planEvery(samplePeriod) == 0) {
+    Serial.println("Could not program the wake alarm");
+    delay(1000);
+    return;
+  }
+
+  // Let the last characters leave the UART before the clock stops
+  Serial.flush();
+  sleeper.sleep();
+
+  // One epoch read, the software clock continues from the alarm edge
+  sleeper.wake();
+  totalSlept += sleeper.sleptMillis();
+}
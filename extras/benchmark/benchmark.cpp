@@ -0,0 +1,488 @@
+/******************************
+     DS3231 RTC Benchmark
+
+Host benchmark of the public API over the simulated Wire bus. For every
+call it reports the bus transactions, bytes and modelled bus time per
+operation together with the CPU time in ns/op, and compares them with a
+baseline file. Any bus figure above the baseline fails the run.
+
+Build and run from the library folder:
+
+  g++ -std=gnu++11 -O2 -DARDUINO=10800 -Iextras/host -I. \
+      Himadri_DS3231*.cpp extras/host/host.cpp extras/host/i2cdev.cpp \
+      extras/benchmark/benchmark.cpp -o ds3231_benchmark
+  ./ds3231_benchmark extras/benchmark/baseline.txt
+
+Options:
+  --update      Write the measured figures to the baseline file
+  --check-time  Also fail when ns/op exceeds twice the baseline
+
+The mux.poll(4) row reads four chips on three channels of a simulated
+TCA9548A, starting on the channel selected by the previous poll.
+
+The readEpoch(twoBuses) row reads a chip on Wire and one on a second
+TwoWire bus one after the other, the bus time is the sum of both buses.
+The line after the table also gives the theoretical upper bound when both
+controllers run at the same time, the longer of the two bus times.
+
+The (linux) rows run the driver through Himadri_DS3231_LinuxTransport on
+the i2c-dev stand-in of extras/host/i2cdev.h with the chip of Wire on it.
+Before the table a value written through the stand-in is read back over
+Wire and the other way round, a mismatch fails the run.
+
+Add -DHIMADRI_DS3231_BCD_ARITHMETIC to the build to compare the decode
+and encode of the date and time registers with the per-field arithmetic
+BCD conversion instead of the table.
+
+******************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <Himadri_DS3231.h>
+#include <Himadri_DS3231_AlarmSpec.h>
+#include <Himadri_DS3231_Mux.h>
+#include <Himadri_DS3231_Transaction.h>
+#include <Himadri_DS3231_LinuxTransport.h>
+#include <i2cdev.h>
+
+/*-------------------------------
+       Benchmark Settings
+-------------------------------*/
+#define BENCH_ITERATIONS            1000
+#define BENCH_MAX_RESULTS           64
+#define BENCH_TIME_TOLERANCE        2.0     // allowed ns/op factor with --check-time
+#define BENCH_MUX_CHIPS             4       // chips behind the simulated TCA9548A
+/*-------------------------------
+       Benchmark Settings
+-------------------------------*/
+
+/*-------------------------------
+        Benchmark Result
+      Structure Declaration
+-------------------------------*/
+typedef struct benchResult {
+  char name[40];
+  double transactions;                    // bus transactions per operation
+  double bytes;                           // bytes written and read per operation
+  double busMicros;                       // modelled bus time per operation
+  double nsPerOp;                         // CPU time per operation
+  double parallelMicros;                  // bus time per operation with the buses overlapped, 0 when unused
+};
+
+static Himadri_DS3231 rtc;
+static TwoWire wire1;                     // second simulated bus, e.g. Wire1 of a Teensy / ESP32
+static Himadri_DS3231 rtc1(wire1, DS3231_ADDRESS);
+// The mux and every chip behind it are separate simulated buses, counted together
+static TwoWire muxWire(DS3231_MUX_ADDRESS);
+static TwoWire muxChips[BENCH_MUX_CHIPS];
+static Himadri_DS3231_Mux mux(muxWire);
+static Himadri_DS3231_MuxDevice muxDevice0(mux, 6, muxChips[0]);
+static Himadri_DS3231_MuxDevice muxDevice1(mux, 1, muxChips[1]);
+static Himadri_DS3231_MuxDevice muxDevice2(mux, 4, muxChips[2]);
+static Himadri_DS3231_MuxDevice muxDevice3(mux, 1, muxChips[3]);
+static Himadri_DS3231_MuxDevice* const muxDevices[BENCH_MUX_CHIPS] = {
+  &muxDevice0, &muxDevice1, &muxDevice2, &muxDevice3
+};
+// The i2c-dev stand-in only keeps a reference to the chip, so it can be opened before Wire is constructed
+static Himadri_DS3231_LinuxTransport linuxBus(hostI2cDevOpen(Wire), DS3231_ADDRESS, hostI2cDevIoctl);
+static Himadri_DS3231 rtcLinux(linuxBus);
+static struct benchResult results[BENCH_MAX_RESULTS];
+static uint8_t resultCount = 0;
+static volatile uint32_t sink = 0;        // keeps the results of the calls alive
+
+/**
+  Returns the CPU time of the process in nanoseconds.
+**/
+static double cpuNanos() {
+  struct timespec ts;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+  Run one operation the given number of times and record its figures.
+**/
+static void bench(const char* name, void (*op)(void), uint16_t iterations = BENCH_ITERATIONS) {
+  struct benchResult* r = &results[resultCount++];
+
+  op();                                   // warm the shadow copy and the caches
+  Wire.resetCounters();
+  double start = cpuNanos();
+  for(uint16_t i = 0; i < iterations; i++) {
+    op();
+  }
+  double elapsed = cpuNanos() - start;
+
+  strncpy(r->name, name, sizeof(r->name) - 1);
+  r->parallelMicros = 0;
+  r->transactions = (double)Wire.transactions() / iterations;
+  r->bytes = (double)(Wire.bytesWritten() + Wire.bytesRead()) / iterations;
+  r->busMicros = (double)Wire.busMicros() / iterations;
+  r->nsPerOp = elapsed / iterations;
+}
+
+/**
+  Read the epoch of the chips on Wire and wire1 and record the figures of
+  both buses. The reads run one after the other, so the bus time of the
+  pair is the sum of the two, the longer of the two is kept as the bound
+  for controllers running at the same time.
+**/
+static void benchTwoBuses(const char* name, uint16_t iterations = BENCH_ITERATIONS) {
+  struct benchResult* r = &results[resultCount++];
+  uint32_t epoch;
+
+  Wire.resetCounters();
+  wire1.resetCounters();
+  double start = cpuNanos();
+  for(uint16_t i = 0; i < iterations; i++) {
+    sink += rtc.readEpoch(&epoch);
+    sink += rtc1.readEpoch(&epoch);
+  }
+  double elapsed = cpuNanos() - start;
+
+  uint32_t longer = Wire.busMicros() > wire1.busMicros() ? Wire.busMicros() : wire1.busMicros();
+  strncpy(r->name, name, sizeof(r->name) - 1);
+  r->transactions = (double)(Wire.transactions() + wire1.transactions()) / iterations;
+  r->bytes = (double)(Wire.bytesWritten() + Wire.bytesRead() +
+    wire1.bytesWritten() + wire1.bytesRead()) / iterations;
+  r->busMicros = (double)(Wire.busMicros() + wire1.busMicros()) / iterations;
+  r->nsPerOp = elapsed / iterations;
+  r->parallelMicros = (double)longer / iterations;
+}
+
+/**
+  Poll the chips behind the mux and record the figures of the mux and the
+  chips together, as they share one bus.
+**/
+static void benchMuxPoll(const char* name, uint16_t iterations = BENCH_ITERATIONS) {
+  struct benchResult* r = &results[resultCount++];
+  uint32_t epochs[BENCH_MUX_CHIPS];
+  uint32_t transactions = 0, bytes = 0, busMicros = 0;
+
+  sink += mux.poll(muxDevices, BENCH_MUX_CHIPS, epochs);
+  muxWire.resetCounters();
+  for(uint8_t i = 0; i < BENCH_MUX_CHIPS; i++) {
+    muxChips[i].resetCounters();
+  }
+  double start = cpuNanos();
+  for(uint16_t i = 0; i < iterations; i++) {
+    sink += mux.poll(muxDevices, BENCH_MUX_CHIPS, epochs);
+  }
+  double elapsed = cpuNanos() - start;
+
+  transactions = muxWire.transactions();
+  bytes = muxWire.bytesWritten() + muxWire.bytesRead();
+  busMicros = muxWire.busMicros();
+  for(uint8_t i = 0; i < BENCH_MUX_CHIPS; i++) {
+    transactions += muxChips[i].transactions();
+    bytes += muxChips[i].bytesWritten() + muxChips[i].bytesRead();
+    busMicros += muxChips[i].busMicros();
+  }
+  strncpy(r->name, name, sizeof(r->name) - 1);
+  r->transactions = (double)transactions / iterations;
+  r->bytes = (double)bytes / iterations;
+  r->busMicros = (double)busMicros / iterations;
+  r->nsPerOp = elapsed / iterations;
+  r->parallelMicros = 0;
+}
+
+/*-------------------------------
+      Benchmarked Operations
+-------------------------------*/
+static void opBegin() { sink += rtc.begin(); }
+
+static void opBeginConfig() {
+  struct configParameters config = {DS3231_CONFIG_CONTROL, DS3231_CONFIG_EN32KHZ};
+  sink += rtc.beginConfig(&config);
+}
+
+static void opSetDateTime() {
+  struct timeParameters timeVals = {0, 30, 15, 10, 0, 3, 16, 10, 2024};
+  sink += rtc.setDateTime(&timeVals);
+}
+
+static void opSetSecMinHour() {
+  sink += rtc.setSeconds(0);
+  sink += rtc.setMinutes(30);
+  sink += rtc.setHour(15, false, false);
+}
+
+static void opCommitSecMinHour() {
+  Himadri_DS3231_Transaction tx(rtc);
+  sink += tx.seconds(0).minutes(30).hour(15, false, false).commit();
+}
+
+static void opSetYear() { sink += rtc.setYear(2024); }
+
+static void opSetDateTimeAtomic() {
+  struct timeParameters timeVals = {0, 30, 15, 10, 0, 3, 16, 10, 2024};
+  sink += rtc.setDateTimeAtomic(&timeVals);
+}
+
+static void opReadDateTime() {
+  struct timeParameters timeVals;
+  sink += rtc.readDateTime(&timeVals);
+}
+
+static void opSetAlarmPeriod() { sink += rtc.setAlarm(Minute, Alarm1); }
+static void opSetAlarmExact() { sink += rtc.setAlarm(Hour, 7, true, true, Alarm1); }
+static void opSetAlarmSecMin() { sink += rtc.setAlarm(10, 20, Alarm1); }
+static void opSetAlarmSecMinHour() { sink += rtc.setAlarm(10, 20, 7, false, false, Alarm1); }
+static void opSetAlarmDayDate() { sink += rtc.setAlarm(10, 20, 7, 15, false, false, false, Alarm1); }
+
+static void opSetAlarmSpec() {
+  static constexpr Himadri_DS3231_AlarmSpec spec =
+    Himadri_DS3231_AlarmSpec::match(10, 20, 7, 15, false, false, false, Alarm1);
+  sink += rtc.setAlarm(spec);
+}
+
+static void opReadAlarm1Time() {
+  struct alarmParameters alarmVals;
+  sink += rtc.readAlarmTime(&alarmVals, Alarm1);
+}
+
+static void opReadAlarm2Time() {
+  struct alarmParameters alarmVals;
+  sink += rtc.readAlarmTime(&alarmVals, Alarm2);
+}
+
+static void opReadTemp() { sink += (uint32_t)rtc.readTemp(); }
+
+static void opReadTempRaw() {
+  int16_t quarterDegrees;
+  sink += rtc.readTempRaw(&quarterDegrees);
+}
+
+static void opReadTempCentiDegrees() {
+  int32_t centiDegrees;
+  sink += rtc.readTempCentiDegrees(&centiDegrees, Fahrenheit);
+}
+static void opControlRegValue() { sink += rtc.controlRegValue(); }
+static void opControlRegValueCached() { sink += rtc.controlRegValue(true); }
+static void opOscillatorStatus() { sink += rtc.oscillatorStatus(); }
+static void opBbsqwStatus() { sink += rtc.bbsqwStatus(); }
+static void opIntcnStatus() { sink += rtc.intcnStatus(); }
+static void opStatusRegValue() { sink += rtc.statusRegValue(); }
+static void opStatusRegValueCached() { sink += rtc.statusRegValue(true); }
+static void opOsfStatus() { sink += rtc.osfStatus(); }
+static void opEn32KhzStatus() { sink += rtc.en32KhzStatus(); }
+static void opBsyStatus() { sink += rtc.bsyStatus(); }
+static void opAlarmStatus() { sink += rtc.alarmStatus(Alarm1); }
+
+static void opReadClearAlarmStatus() {
+  uint8_t alarms;
+  sink += rtc.readClearAlarmStatus(&alarms);
+}
+static void opAgingRegValue() { sink += rtc.agingRegValue(); }
+
+static void opReadSnapshot() {
+  struct snapshotParameters snapVals;
+  sink += rtc.readSnapshot(&snapVals);
+}
+
+static void opReadEpoch() {
+  uint32_t epoch;
+  sink += rtc.readEpoch(&epoch);
+}
+
+static void opSetEpoch() { sink += rtc.setEpoch(1729090800UL); }
+static void opSetEpochAligned() { sink += rtc.setEpochAligned(1729090800UL, 500000UL); }
+
+static void opReadEpochLinux() {
+  uint32_t epoch;
+  sink += rtcLinux.readEpoch(&epoch);
+}
+
+static void opSetEpochLinux() { sink += rtcLinux.setEpoch(1729090800UL); }
+
+/**
+  Write through the i2c-dev stand-in and read back over Wire, then the
+  other way round.
+**/
+static boolean checkLinuxTransport() {
+  uint32_t epoch;
+
+  if(linuxBus.isOpen() == false || rtcLinux.begin() == false) {
+    return false;
+  }
+  if(rtcLinux.setEpoch(1729090800UL) == false || rtc.readEpoch(&epoch) == false || epoch != 1729090800UL) {
+    return false;
+  }
+  if(rtc.setEpoch(1729090900UL) == false || rtcLinux.readEpoch(&epoch) == false || epoch != 1729090900UL) {
+    return false;
+  }
+  return true;
+}
+/*-------------------------------
+      Benchmarked Operations
+-------------------------------*/
+
+/**
+  Write the measured figures as the new baseline.
+**/
+static boolean writeBaseline(const char* path) {
+  FILE* f = fopen(path, "w");
+  if(f == NULL) {
+    return false;
+  }
+  fprintf(f, "# name transactions/op bytes/op bus_us/op ns/op\n");
+  for(uint8_t i = 0; i < resultCount; i++) {
+    fprintf(f, "%s %.2f %.2f %.2f %.0f\n", results[i].name, results[i].transactions,
+      results[i].bytes, results[i].busMicros, results[i].nsPerOp);
+  }
+  fclose(f);
+  return true;
+}
+
+/**
+  Compare the measured figures with the baseline, returns the number of regressions.
+**/
+static int checkBaseline(const char* path, boolean checkTime) {
+  FILE* f = fopen(path, "r");
+  char line[128];
+  int regressions = 0;
+
+  if(f == NULL) {
+    printf("no baseline %s, run with --update to create it\n", path);
+    return 1;
+  }
+  while(fgets(line, sizeof(line), f) != NULL) {
+    struct benchResult base;
+    if(line[0] == '#' || sscanf(line, "%39s %lf %lf %lf %lf", base.name, &base.transactions,
+      &base.bytes, &base.busMicros, &base.nsPerOp) != 5) {
+      continue;
+    }
+    struct benchResult* r = NULL;
+    for(uint8_t i = 0; i < resultCount; i++) {
+      if(strcmp(results[i].name, base.name) == 0) {
+        r = &results[i];
+      }
+    }
+    if(r == NULL) {
+      printf("REGRESSION %s: missing from the benchmark\n", base.name);
+      regressions++;
+      continue;
+    }
+    // The bus figures are deterministic, 0.005 absorbs the rounding of the file
+    if(r->transactions > base.transactions + 0.005 || r->bytes > base.bytes + 0.005 ||
+      r->busMicros > base.busMicros + 0.005) {
+      printf("REGRESSION %s: %.2f tx %.2f bytes %.2f us, baseline %.2f tx %.2f bytes %.2f us\n",
+        r->name, r->transactions, r->bytes, r->busMicros, base.transactions, base.bytes, base.busMicros);
+      regressions++;
+    } else if(r->transactions < base.transactions - 0.005 || r->bytes < base.bytes - 0.005) {
+      printf("improved   %s: %.2f tx %.2f bytes, baseline %.2f tx %.2f bytes\n",
+        r->name, r->transactions, r->bytes, base.transactions, base.bytes);
+    }
+    if(checkTime && r->nsPerOp > base.nsPerOp * BENCH_TIME_TOLERANCE) {
+      printf("REGRESSION %s: %.0f ns/op, baseline %.0f ns/op\n", r->name, r->nsPerOp, base.nsPerOp);
+      regressions++;
+    }
+  }
+  fclose(f);
+  return regressions;
+}
+
+int main(int argc, char** argv) {
+  const char* path = "extras/benchmark/baseline.txt";
+  boolean update = false;
+  boolean checkTime = false;
+
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--update") == 0) {
+      update = true;
+    } else if(strcmp(argv[i], "--check-time") == 0) {
+      checkTime = true;
+    } else {
+      path = argv[i];
+    }
+  }
+
+  if(checkLinuxTransport() == false) {
+    printf("Linux transport on the i2c-dev stand-in does not match Wire\n");
+    return 1;
+  }
+
+  // Date and time in range so the reads decode, as after a normal setup
+  rtc.setEpoch(1729090800UL);
+  rtc1.setEpoch(1729090800UL);
+  for(uint8_t i = 0; i < BENCH_MUX_CHIPS; i++) {
+    muxDevices[i]->rtc.setEpoch(1729090800UL);
+  }
+
+  bench("begin", opBegin);
+  bench("beginConfig", opBeginConfig);
+  bench("setDateTime", opSetDateTime);
+  bench("setDateTimeAtomic", opSetDateTimeAtomic);
+  bench("setSeconds/Minutes/Hour", opSetSecMinHour);
+  bench("commit(ss,mm,hh)", opCommitSecMinHour);
+  bench("setYear", opSetYear);
+  bench("readDateTime", opReadDateTime);
+  bench("setAlarm(periodicity)", opSetAlarmPeriod);
+  bench("setAlarm(periodicity,val)", opSetAlarmExact);
+  bench("setAlarm(ss,mm)", opSetAlarmSecMin);
+  bench("setAlarm(ss,mm,hh)", opSetAlarmSecMinHour);
+  bench("setAlarm(ss,mm,hh,dyDt)", opSetAlarmDayDate);
+  bench("setAlarm(spec)", opSetAlarmSpec);
+  bench("readAlarmTime(Alarm1)", opReadAlarm1Time);
+  bench("readAlarmTime(Alarm2)", opReadAlarm2Time);
+  bench("readTemp", opReadTemp);
+  bench("readTempRaw", opReadTempRaw);
+  bench("readTempCentiDegrees(F)", opReadTempCentiDegrees);
+  bench("controlRegValue", opControlRegValue);
+  bench("controlRegValue(cached)", opControlRegValueCached);
+  bench("oscillatorStatus", opOscillatorStatus);
+  bench("bbsqwStatus", opBbsqwStatus);
+  bench("intcnStatus", opIntcnStatus);
+  bench("statusRegValue", opStatusRegValue);
+  bench("statusRegValue(cached)", opStatusRegValueCached);
+  bench("osfStatus", opOsfStatus);
+  bench("en32KhzStatus", opEn32KhzStatus);
+  bench("bsyStatus", opBsyStatus);
+  bench("alarmStatus", opAlarmStatus);
+  bench("readClearAlarmStatus", opReadClearAlarmStatus);
+  bench("agingRegValue", opAgingRegValue);
+  bench("readSnapshot", opReadSnapshot);
+  bench("readEpoch", opReadEpoch);
+  bench("setEpoch", opSetEpoch);
+  // Waits for the second boundary of the virtual clock, a few runs are enough
+  bench("setEpochAligned", opSetEpochAligned, 100);
+  bench("readEpoch(linux)", opReadEpochLinux);
+  bench("setEpoch(linux)", opSetEpochLinux);
+  benchTwoBuses("readEpoch(twoBuses)");
+  benchMuxPoll("mux.poll(4)");
+
+  printf("%-28s %8s %8s %9s %10s\n", "api", "tx/op", "bytes/op", "bus_us/op", "ns/op");
+  for(uint8_t i = 0; i < resultCount; i++) {
+    printf("%-28s %8.2f %8.2f %9.2f %10.0f\n", results[i].name, results[i].transactions,
+      results[i].bytes, results[i].busMicros, results[i].nsPerOp);
+  }
+  for(uint8_t i = 0; i < resultCount; i++) {
+    if(results[i].parallelMicros != 0) {
+      printf("%s: %.0f reads/s sequential, %.0f reads/s theoretical upper bound with parallel buses\n",
+        results[i].name, 2e6 / results[i].busMicros, 2e6 / results[i].parallelMicros);
+    }
+  }
+
+  if(update) {
+    if(writeBaseline(path) == false) {
+      printf("cannot write %s\n", path);
+      return 1;
+    }
+    printf("baseline written to %s\n", path);
+    return 0;
+  }
+
+  int regressions = checkBaseline(path, checkTime);
+  if(regressions > 0) {
+    printf("%d regression(s)\n", regressions);
+    return 1;
+  }
+  printf("no regressions\n");
+  return 0;
+}
+
+/******************************
+     DS3231 RTC Benchmark
+******************************/
@@ -0,0 +1,102 @@
+/******************************
+      DS3231 RTC Host Shim
+
+Minimal Arduino core for building the library on a workstation. The
+clock is virtual: it only advances through delay(), delayMicroseconds()
+and the modelled bus time of the simulated Wire bus, so every run is
+deterministic. Pins can be driven by the simulated chip to fire
+attached interrupts. With -DHIMADRI_DS3231_HOST_MONOTONIC the clock
+follows CLOCK_MONOTONIC instead, for running on a Linux board.
+
+******************************/
+
+/**
+    Arduino.h
+    Purpose: Host replacement for the Arduino core header.
+*/
+
+#ifndef HIMADRI_DS3231_HOST_ARDUINO_H
+
+  #define HIMADRI_DS3231_HOST_ARDUINO_H
+
+  #include <stdint.h>
+  #include <stddef.h>
+  #include <string.h>
+  #include <math.h>
+
+  #ifndef ARDUINO
+    #define ARDUINO                   10800
+  #endif
+
+  #define HIMADRI_DS3231_HOST         1
+
+  #define HIGH                        0x1
+  #define LOW                         0x0
+
+  #define INPUT                       0x0
+  #define OUTPUT                      0x1
+  #define INPUT_PULLUP                0x2
+
+  #define CHANGE                      1
+  #define FALLING                     2
+  #define RISING                      3
+
+  #define PROGMEM
+  #define pgm_read_byte(addr)         (*(const uint8_t*)(addr))
+  #define pgm_read_word(addr)         (*(const uint16_t*)(addr))
+
+  typedef bool boolean;
+  typedef uint8_t byte;
+
+  unsigned long millis(void);
+  unsigned long micros(void);
+  void delay(unsigned long ms);
+  void delayMicroseconds(unsigned int us);
+
+  inline void interrupts(void) {}
+  inline void noInterrupts(void) {}
+
+  #define digitalPinToInterrupt(p)    (p)
+
+  void pinMode(uint8_t pin, uint8_t mode);
+  int digitalRead(uint8_t pin);
+  void digitalWrite(uint8_t pin, uint8_t value);
+  void attachInterrupt(uint8_t interruptNum, void (*userFunc)(void), int mode);
+  void detachInterrupt(uint8_t interruptNum);
+
+  /**
+    Drive an input pin from a level function, e.g. the INT/SQW pin of the
+    simulated DS3231. While an interrupt is attached to a driven pin the
+    virtual clock advances in small steps and fires it on the edges.
+
+    @param pin The pin number
+    @param level Function returning HIGH / LOW, NULL to release the pin
+    @return Return void
+  */
+  void hostConnectPin(uint8_t pin, uint8_t (*level)(void));
+
+  class HardwareSerial {
+    public:
+      void begin(unsigned long baud);
+      size_t print(const char* s);
+      size_t print(long n);
+      size_t print(unsigned long n);
+      size_t print(int n);
+      size_t print(unsigned int n);
+      size_t print(double n, int digits = 2);
+      size_t println(void);
+      size_t println(const char* s);
+      size_t println(long n);
+      size_t println(unsigned long n);
+      size_t println(int n);
+      size_t println(unsigned int n);
+      size_t println(double n, int digits = 2);
+  };
+
+  extern HardwareSerial Serial;
+
+#endif
+
+/******************************
+      DS3231 RTC Host Shim
+******************************/
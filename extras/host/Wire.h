@@ -0,0 +1,32 @@
+/******************************
+      DS3231 RTC Host Shim
+
+The host Wire bus is the DS3231 register model, so every transaction the
+library issues lands in the simulated chip and is counted.
+
+******************************/
+
+/**
+    Wire.h
+    Purpose: Host replacement for the Arduino Wire library.
+*/
+
+#ifndef HIMADRI_DS3231_HOST_WIRE_H
+
+  #define HIMADRI_DS3231_HOST_WIRE_H
+
+  #include <Arduino.h>
+  #include "Himadri_DS3231_Sim.h"
+
+  class TwoWire : public Himadri_DS3231_Sim {
+    public:
+      TwoWire(uint8_t address = 0x68);
+  };
+
+  extern TwoWire Wire;
+
+#endif
+
+/******************************
+      DS3231 RTC Host Shim
+******************************/
@@ -0,0 +1,270 @@
+/******************************
+      DS3231 RTC Host Shim
+
+Virtual clock, pins, console Serial and the global simulated Wire bus.
+
+Built with -DHIMADRI_DS3231_HOST_MONOTONIC, millis(), micros() and delay()
+follow CLOCK_MONOTONIC instead of the virtual clock, for programs driving
+a real chip through Himadri_DS3231_LinuxTransport on a Linux board.
+
+******************************/
+
+#include <stdio.h>
+#if defined(HIMADRI_DS3231_HOST_MONOTONIC)
+  #include <time.h>
+#endif
+#include <Arduino.h>
+#include <Wire.h>
+
+/*-------------------------------
+        Virtual Clock
+-------------------------------*/
+#define HOST_PINS                   32
+#define HOST_PIN_STEP_US            20
+
+static unsigned long hostMicros = 0;
+
+static uint8_t (*pinLevel[HOST_PINS])(void);
+static void (*pinIsr[HOST_PINS])(void);
+static int pinIsrMode[HOST_PINS];
+static uint8_t pinLast[HOST_PINS];
+static uint8_t pinWatched = 0;
+static boolean inIsr = false;
+
+/**
+  Fire the attached interrupts whose driven pin changed level.
+**/
+static void samplePins() {
+  for(uint8_t pin = 0; pin < HOST_PINS; pin++) {
+    if(pinLevel[pin] == NULL || pinIsr[pin] == NULL) {
+      continue;
+    }
+    uint8_t level = pinLevel[pin]();
+    uint8_t last = pinLast[pin];
+    pinLast[pin] = level;
+    if(level == last || inIsr) {
+      continue;
+    }
+    if(pinIsrMode[pin] == CHANGE || (pinIsrMode[pin] == FALLING && level == LOW) ||
+      (pinIsrMode[pin] == RISING && level == HIGH)) {
+      inIsr = true;
+      pinIsr[pin]();
+      inIsr = false;
+    }
+  }
+}
+
+/**
+  Advance the virtual clock, stepping through the pin edges if needed.
+**/
+static void advance(unsigned long us) {
+  if(pinWatched == 0 || inIsr) {
+    hostMicros += us;
+    return;
+  }
+  while(us > 0) {
+    unsigned long step = us < HOST_PIN_STEP_US ? us : HOST_PIN_STEP_US;
+    hostMicros += step;
+    us -= step;
+    samplePins();
+  }
+}
+
+static void updateWatched() {
+  pinWatched = 0;
+  for(uint8_t pin = 0; pin < HOST_PINS; pin++) {
+    if(pinLevel[pin] != NULL && pinIsr[pin] != NULL) {
+      pinWatched++;
+      pinLast[pin] = pinLevel[pin]();
+    }
+  }
+}
+
+#if defined(HIMADRI_DS3231_HOST_MONOTONIC)
+
+/**
+  Microseconds of CLOCK_MONOTONIC since the first call.
+**/
+static unsigned long monotonicMicros() {
+  static unsigned long long start = 0;
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  unsigned long long now = (unsigned long long)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+  if(start == 0) {
+    start = now;
+  }
+  return (unsigned long)(now - start);
+}
+
+/**
+  Sleep for the time, stepping through the pin edges if needed.
+**/
+static void sleepMicros(unsigned long us) {
+  unsigned long begin = monotonicMicros();
+
+  while(monotonicMicros() - begin < us) {
+    unsigned long left = us - (monotonicMicros() - begin);
+    unsigned long step = pinWatched == 0 || left < HOST_PIN_STEP_US ? left : HOST_PIN_STEP_US;
+    struct timespec ts;
+    ts.tv_sec = step / 1000000UL;
+    ts.tv_nsec = (step % 1000000UL) * 1000UL;
+    nanosleep(&ts, NULL);
+    if(pinWatched != 0) {
+      samplePins();
+    }
+  }
+}
+
+unsigned long millis() {
+  return monotonicMicros() / 1000UL;
+}
+
+unsigned long micros() {
+  return monotonicMicros();
+}
+
+void delay(unsigned long ms) {
+  sleepMicros(ms * 1000UL);
+}
+
+void delayMicroseconds(unsigned int us) {
+  sleepMicros(us);
+}
+
+#else
+
+unsigned long millis() {
+  return hostMicros / 1000UL;
+}
+
+unsigned long micros() {
+  return hostMicros;
+}
+
+void delay(unsigned long ms) {
+  advance(ms * 1000UL);
+}
+
+void delayMicroseconds(unsigned int us) {
+  advance(us);
+}
+
+#endif
+
+/*-------------------------------
+      Pins And Interrupts
+-------------------------------*/
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+
+int digitalRead(uint8_t pin) {
+  if(pin < HOST_PINS && pinLevel[pin] != NULL) {
+    return pinLevel[pin]();
+  }
+  return HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  (void)pin;
+  (void)value;
+}
+
+void attachInterrupt(uint8_t interruptNum, void (*userFunc)(void), int mode) {
+  if(interruptNum < HOST_PINS) {
+    pinIsr[interruptNum] = userFunc;
+    pinIsrMode[interruptNum] = mode;
+    updateWatched();
+  }
+}
+
+void detachInterrupt(uint8_t interruptNum) {
+  if(interruptNum < HOST_PINS) {
+    pinIsr[interruptNum] = NULL;
+    updateWatched();
+  }
+}
+
+void hostConnectPin(uint8_t pin, uint8_t (*level)(void)) {
+  if(pin < HOST_PINS) {
+    pinLevel[pin] = level;
+    updateWatched();
+  }
+}
+
+/*-------------------------------
+          Console Serial
+-------------------------------*/
+HardwareSerial Serial;
+
+void HardwareSerial::begin(unsigned long baud) {
+  (void)baud;
+}
+
+size_t HardwareSerial::print(const char* s) {
+  return (size_t)printf("%s", s);
+}
+
+size_t HardwareSerial::print(long n) {
+  return (size_t)printf("%ld", n);
+}
+
+size_t HardwareSerial::print(unsigned long n) {
+  return (size_t)printf("%lu", n);
+}
+
+size_t HardwareSerial::print(int n) {
+  return (size_t)printf("%d", n);
+}
+
+size_t HardwareSerial::print(unsigned int n) {
+  return (size_t)printf("%u", n);
+}
+
+size_t HardwareSerial::print(double n, int digits) {
+  return (size_t)printf("%.*f", digits, n);
+}
+
+size_t HardwareSerial::println() {
+  return (size_t)printf("\n");
+}
+
+size_t HardwareSerial::println(const char* s) {
+  return print(s) + println();
+}
+
+size_t HardwareSerial::println(long n) {
+  return print(n) + println();
+}
+
+size_t HardwareSerial::println(unsigned long n) {
+  return print(n) + println();
+}
+
+size_t HardwareSerial::println(int n) {
+  return print(n) + println();
+}
+
+size_t HardwareSerial::println(unsigned int n) {
+  return print(n) + println();
+}
+
+size_t HardwareSerial::println(double n, int digits) {
+  return print(n, digits) + println();
+}
+
+/*-------------------------------
+       Simulated Wire Bus
+-------------------------------*/
+TwoWire::TwoWire(uint8_t address) : Himadri_DS3231_Sim(address) {
+  // Let the modelled bus time pass on the virtual clock
+  simulateBusTime(true);
+}
+
+TwoWire Wire;
+
+/******************************
+      DS3231 RTC Host Shim
+******************************/
@@ -0,0 +1,123 @@
+/******************************
+      DS3231 RTC Host Shim
+
+File descriptor stand-in for a Linux i2c-dev node.
+
+******************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <Arduino.h>
+#include "i2cdev.h"
+
+/*-------------------------------
+      Open Stand-in Devices
+-------------------------------*/
+#define HOST_I2CDEV_MAX             8
+
+static int devFd[HOST_I2CDEV_MAX] = {-1, -1, -1, -1, -1, -1, -1, -1};
+static Himadri_DS3231_Sim* devChip[HOST_I2CDEV_MAX];
+
+/**
+  Returns the chip behind a stand-in descriptor.
+**/
+static Himadri_DS3231_Sim* findChip(int fd) {
+  for(uint8_t i = 0; i < HOST_I2CDEV_MAX; i++) {
+    if(devFd[i] == fd && fd >= 0) {
+      return devChip[i];
+    }
+  }
+  return NULL;
+}
+
+/**
+  Run the messages on the chip, a message after the first one starts
+  with a repeated START like the i2c-dev adapters do.
+**/
+static int transfer(Himadri_DS3231_Sim* chip, struct i2c_rdwr_ioctl_data* data) {
+  for(uint32_t i = 0; i < data->nmsgs; i++) {
+    struct i2c_msg* msg = &data->msgs[i];
+    uint8_t stop = (i + 1 == data->nmsgs);
+
+    // Like the adapters flagged I2C_AQ_NO_ZERO_LEN
+    if(msg->len == 0) {
+      errno = EOPNOTSUPP;
+      return -1;
+    }
+    if(msg->flags & I2C_M_RD) {
+      if(chip->requestFrom((uint8_t)msg->addr, (uint8_t)msg->len, stop) != msg->len) {
+        errno = ENXIO;
+        return -1;
+      }
+      for(uint16_t n = 0; n < msg->len; n++) {
+        msg->buf[n] = (uint8_t)chip->read();
+      }
+    } else {
+      chip->beginTransmission((uint8_t)msg->addr);
+      chip->write(msg->buf, msg->len);
+      if(chip->endTransmission(stop) != 0) {
+        errno = ENXIO;
+        return -1;
+      }
+    }
+  }
+  return data->nmsgs;
+}
+
+int hostI2cDevOpen(Himadri_DS3231_Sim& chip) {
+  for(uint8_t i = 0; i < HOST_I2CDEV_MAX; i++) {
+    if(devFd[i] < 0) {
+      // A real descriptor keeps the number unique while it is open
+      int fd = open("/dev/null", O_RDWR);
+      if(fd < 0) {
+        return -1;
+      }
+      devFd[i] = fd;
+      devChip[i] = &chip;
+      return fd;
+    }
+  }
+  errno = EMFILE;
+  return -1;
+}
+
+int hostI2cDevClose(int fd) {
+  for(uint8_t i = 0; i < HOST_I2CDEV_MAX; i++) {
+    if(devFd[i] == fd && fd >= 0) {
+      devFd[i] = -1;
+      devChip[i] = NULL;
+      return close(fd);
+    }
+  }
+  errno = EBADF;
+  return -1;
+}
+
+int hostI2cDevIoctl(int fd, unsigned long request, void* arg) {
+  Himadri_DS3231_Sim* chip = findChip(fd);
+
+  if(chip == NULL) {
+    return ioctl(fd, request, arg);
+  }
+  switch(request) {
+    case I2C_RDWR:
+      return transfer(chip, (struct i2c_rdwr_ioctl_data*)arg);
+    case I2C_FUNCS:
+      *(unsigned long*)arg = I2C_FUNC_I2C;
+      return 0;
+    case I2C_SLAVE:
+    case I2C_SLAVE_FORCE:
+      return 0;
+    default:
+      errno = ENOTTY;
+      return -1;
+  }
+}
+
+/******************************
+      DS3231 RTC Host Shim
+******************************/
@@ -0,0 +1,57 @@
+/******************************
+      DS3231 RTC Host Shim
+
+File descriptor stand-in for a Linux i2c-dev node. A descriptor opened
+with hostI2cDevOpen() answers the I2C_RDWR, I2C_FUNCS and I2C_SLAVE
+requests from a simulated DS3231 through hostI2cDevIoctl(), so the Linux
+transport runs without an adapter when it is given that function:
+
+  int fd = hostI2cDevOpen(Wire);
+  Himadri_DS3231_LinuxTransport bus(fd, DS3231_ADDRESS, hostI2cDevIoctl);
+
+Every other descriptor is passed to the real ioctl().
+
+******************************/
+
+/**
+    i2cdev.h
+    Purpose: Host stand-in for a /dev/i2c-N file descriptor.
+*/
+
+#ifndef HIMADRI_DS3231_HOST_I2CDEV_H
+
+  #define HIMADRI_DS3231_HOST_I2CDEV_H
+
+  #include "Himadri_DS3231_Sim.h"
+
+  /**
+    Open a file descriptor emulating an i2c-dev node with the chip on it
+
+    @param chip The simulated DS3231 answering the transfers
+    @return Return the file descriptor or -1 on error
+  */
+  int hostI2cDevOpen(Himadri_DS3231_Sim& chip);
+
+  /**
+    Close a descriptor opened with hostI2cDevOpen()
+
+    @param fd The file descriptor
+    @return Return 0 or -1 on error
+  */
+  int hostI2cDevClose(int fd);
+
+  /**
+    ioctl() of the stand-in
+
+    @param fd The file descriptor
+    @param request The ioctl request
+    @param arg The ioctl argument
+    @return Return the ioctl() result, -1 with errno set on error
+  */
+  int hostI2cDevIoctl(int fd, unsigned long request, void* arg);
+
+#endif
+
+/******************************
+      DS3231 RTC Host Shim
+******************************/